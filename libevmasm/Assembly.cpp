@@ -429,11 +429,21 @@ map<u256, u256> const& Assembly::optimiseInternal(
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
+			// The control flow graph is only used to determine the knowledge at the start of
+			// basic blocks, which is reset for all tags whenever there is a jump to an unknown target.
+			// Since tags referenced from outside can be jumped to without that, it is not used then.
+			map<unsigned, KnownStatePointer> blockStartStates;
+			if (_settings.runCSEAcrossBlocks && _tagsReferencedFromOutside.empty() && !usesMSize)
+				blockStartStates = ControlFlowGraph{m_items}.blockStartStates();
+
 			auto iter = m_items.begin();
 			while (iter != m_items.end())
 			{
-				KnownState emptyState;
-				CommonSubexpressionEliminator eliminator{emptyState};
+				KnownState initialState;
+				auto startState = blockStartStates.find(static_cast<unsigned>(iter - m_items.begin()));
+				if (startState != blockStartStates.end())
+					initialState = *startState->second;
+				CommonSubexpressionEliminator eliminator{initialState};
 				auto orig = iter;
 				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
 				bool shouldReplace = false;
@@ -796,12 +806,13 @@ Assembly const* Assembly::subAssemblyById(size_t _subId) const
 Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, _evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, false, _evmVersion, 0};
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
 	asmSettings.runDeduplicate = _settings.runDeduplicate;
 	asmSettings.runCSE = _settings.runCSE;
+	asmSettings.runCSEAcrossBlocks = _settings.runCSEAcrossBlocks;
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
 	asmSettings.evmVersion = _evmVersion;
@@ -124,6 +124,9 @@ public:
 		bool runPeephole = false;
 		bool runDeduplicate = false;
 		bool runCSE = false;
+		/// Start the common subexpression eliminator with the state known at the start of each
+		/// basic block, as determined by the ControlFlowGraph. Only used if @a runCSE is set.
+		bool runCSEAcrossBlocks = false;
 		bool runConstantOptimiser = false;
 		langutil::EVMVersion evmVersion;
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
@@ -27,14 +27,35 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
-#include <functional>
-#include <set>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
 
 
+namespace
+{
+
+/// @returns a hash of @a _item that is consistent with ``AssemblyItem::operator==``.
+size_t itemHash(AssemblyItem const& _item)
+{
+	size_t hash = static_cast<size_t>(_item.type());
+	if (_item.type() == Operation)
+		boost::hash_combine(hash, static_cast<size_t>(_item.instruction()));
+	else if (_item.type() == VerbatimBytecode)
+		boost::hash_combine(hash, boost::hash_range(_item.verbatimData().begin(), _item.verbatimData().end()));
+	else
+		boost::hash_combine(hash, static_cast<size_t>(_item.data() & numeric_limits<size_t>::max()));
+	return hash;
+}
+
+}
+
 bool BlockDeduplicator::deduplicate()
 {
 	// Compares indices based on the suffix that starts there, ignoring tags and stopping at
@@ -49,46 +70,45 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	using diff_type = BlockIterator::difference_type;
+	BlockIterator end{m_items.end(), m_items.end()};
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag, i.e. @a _pushOwnTag is replaced by pushSelf.
+	auto blockBegin = [&](size_t _tagIndex, AssemblyItem const& _pushOwnTag)
+	{
+		BlockIterator it{m_items.begin() + diff_type(_tagIndex), m_items.end(), &_pushOwnTag, &pushSelf};
+		// Skip the tag itself.
+		return ++it;
+	};
+	auto blockHash = [&](size_t _tagIndex)
+	{
+		AssemblyItem pushOwnTag = m_items.at(_tagIndex).pushTag();
+		size_t hash = 0;
+		for (BlockIterator it = blockBegin(_tagIndex, pushOwnTag); it != end; ++it)
+			boost::hash_combine(hash, itemHash(*it));
+		return hash;
+	};
+	auto sameBlock = [&](size_t _i, size_t _j)
 	{
-		if (_i == _j)
-			return false;
-
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
-
-		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
-
-		using diff_type = BlockIterator::difference_type;
-		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
-		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
-		BlockIterator end{m_items.end(), m_items.end()};
-
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
-
-		return std::lexicographical_compare(first, end, second, end);
+		AssemblyItem pushFirstTag = m_items.at(_i).pushTag();
+		AssemblyItem pushSecondTag = m_items.at(_j).pushTag();
+		return std::equal(blockBegin(_i, pushFirstTag), end, blockBegin(_j, pushSecondTag), end);
 	};
 
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		set<size_t, function<bool(size_t, size_t)>> blocksSeen(comparator);
+		// Blocks are bucketed by the hash of their content, so that only blocks with equal
+		// hashes have to be compared item by item.
+		unordered_map<size_t, vector<size_t>> blocksSeen;
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
 			if (m_items.at(i).type() != Tag)
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
+			vector<size_t>& candidates = blocksSeen[blockHash(i)];
+			auto it = find_if(candidates.begin(), candidates.end(), [&](size_t _j) { return sameBlock(i, _j); });
+			if (it == candidates.end())
+				candidates.emplace_back(i);
 			else
 				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
 		}
@@ -56,6 +56,36 @@ BasicBlocks ControlFlowGraph::optimisedBlocks()
 	return rebuildCode();
 }
 
+map<unsigned, KnownStatePointer> ControlFlowGraph::blockStartStates()
+{
+	map<unsigned, KnownStatePointer> startStates;
+	for (auto const& item: m_items)
+		if (item.type() == PushTag && item.splitForeignPushTag().first != numeric_limits<size_t>::max())
+			return startStates;
+	if (m_items.empty())
+		return startStates;
+
+	findLargestTag();
+	splitBlocks();
+	resolveNextLinks();
+	gatherKnowledge();
+
+	for (auto const& [id, block]: m_blocks)
+	{
+		// Blocks that are never reached, e.g. duplicates left behind by the block deduplicator,
+		// have no start state.
+		if (block.begin >= block.end || !block.startState)
+			continue;
+		KnownStatePointer state = block.startState->copy();
+		state->clearTagUnions();
+		unsigned begin = block.begin;
+		if (m_items.at(begin).type() == Tag)
+			state->feedItem(m_items.at(begin++));
+		startStates[begin] = std::move(state);
+	}
+	return startStates;
+}
+
 void ControlFlowGraph::findLargestTag()
 {
 	m_lastUsedId = 0;
@@ -29,6 +29,7 @@
 #include <libevmasm/ExpressionClasses.h>
 
 #include <vector>
+#include <map>
 #include <memory>
 #include <limits>
 
@@ -108,6 +109,14 @@ public:
 	/// @returns vector of basic blocks in the order they should be used in the final code.
 	/// Should be called only once.
 	BasicBlocks optimisedBlocks();
+	/// @returns the knowledge about the state at the start of each reachable basic block, keyed by
+	/// the index of the first item following the block's tag (or of the first item of the block,
+	/// if it does not start with a tag). The blocks themselves are neither removed nor reordered.
+	/// Knowledge only flows along jumps to pushed tags and into the next block, all tagged blocks
+	/// start without knowledge if there is a jump to an unknown target.
+	/// Returns an empty map if the items push tags of other assemblies.
+	/// Should be called only once.
+	std::map<unsigned, KnownStatePointer> blockStartStates();
 
 private:
 	void findLargestTag();
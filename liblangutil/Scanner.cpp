@@ -1014,17 +1014,20 @@ Token Scanner::scanNumber(char _charSeen)
 tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
-	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
+	size_t const start = sourcePos();
+	advance();
 	// Scan the rest of the identifier characters.
 	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
-	literal.complete();
-	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
+		advance();
+	// Identifiers do not contain escapes, so they can be classified in place and
+	// copied into the literal buffer at once.
+	string_view const identifier = string_view(m_source.source()).substr(start, sourcePos() - start);
+	m_tokens[NextNext].literal.assign(identifier);
+	auto const token = TokenTraits::fromIdentifierOrKeyword(identifier);
 	if (m_kind == ScannerKind::Yul)
 	{
 		// Turn Solidity identifier into a Yul keyword
-		if (m_tokens[NextNext].literal == "leave")
+		if (identifier == "leave")
 			return std::make_tuple(Token::Leave, 0, 0);
 		// Turn non-Yul keywords into identifiers.
 		if (!TokenTraits::isYulKeyword(std::get<0>(token)))
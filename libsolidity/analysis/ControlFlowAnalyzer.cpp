@@ -23,6 +23,9 @@
 
 #include <range/v3/algorithm/sort.hpp>
 
+#include <boost/dynamic_bitset.hpp>
+
+#include <algorithm>
 #include <functional>
 
 using namespace std;
@@ -63,47 +66,83 @@ void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractD
 
 void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, optional<string> _contractName)
 {
-	struct NodeInfo
+	// Number the nodes reachable from the entry in reverse post-order, so that the worklist below
+	// visits a node after its predecessors except along back edges.
+	vector<CFGNode const*> nodes;
+	map<CFGNode const*, size_t> nodeIndices;
 	{
-		set<VariableDeclaration const*> unassignedVariablesAtEntry;
-		set<VariableDeclaration const*> unassignedVariablesAtExit;
-		set<VariableOccurrence const*> uninitializedVariableAccesses;
-		/// Propagate the information from another node to this node.
-		/// To be used to propagate information from a node to its exit nodes.
-		/// Returns true, if new variables were added and thus the current node has
-		/// to be traversed again.
-		bool propagateFrom(NodeInfo const& _entryNode)
+		set<CFGNode const*> visited{_entry};
+		vector<pair<CFGNode const*, size_t>> stack{{_entry, 0}};
+		while (!stack.empty())
 		{
-			size_t previousUnassignedVariablesAtEntry = unassignedVariablesAtEntry.size();
-			size_t previousUninitializedVariableAccessess = uninitializedVariableAccesses.size();
-			unassignedVariablesAtEntry += _entryNode.unassignedVariablesAtExit;
-			uninitializedVariableAccesses += _entryNode.uninitializedVariableAccesses;
-			return
-				unassignedVariablesAtEntry.size() > previousUnassignedVariablesAtEntry ||
-				uninitializedVariableAccesses.size() > previousUninitializedVariableAccessess
-			;
+			auto& [node, exitIndex] = stack.back();
+			if (exitIndex < node->exits.size())
+			{
+				CFGNode const* exit = node->exits[exitIndex++];
+				if (visited.insert(exit).second)
+					stack.emplace_back(exit, 0);
+			}
+			else
+			{
+				nodes.push_back(node);
+				stack.pop_back();
+			}
 		}
+		std::reverse(nodes.begin(), nodes.end());
+		for (size_t index = 0; index < nodes.size(); ++index)
+			nodeIndices[nodes[index]] = index;
+	}
+
+	// Dense indices for the variables and the occurrences that can be an uninitialized access.
+	map<VariableDeclaration const*, size_t> variableIndices;
+	vector<VariableOccurrence const*> accesses;
+	vector<vector<size_t>> occurrenceIndices(nodes.size());
+	for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex)
+		for (auto const& variableOccurrence: nodes[nodeIndex]->variableOccurrences)
+			if (variableOccurrence.kind() == VariableOccurrence::Kind::Assignment || variableOccurrence.kind() == VariableOccurrence::Kind::Declaration)
+				occurrenceIndices[nodeIndex].push_back(
+					variableIndices.emplace(&variableOccurrence.declaration(), variableIndices.size()).first->second
+				);
+			else
+			{
+				occurrenceIndices[nodeIndex].push_back(accesses.size());
+				accesses.push_back(&variableOccurrence);
+			}
+
+	struct NodeInfo
+	{
+		boost::dynamic_bitset<> unassignedVariablesAtEntry;
+		boost::dynamic_bitset<> unassignedVariablesAtExit;
+		boost::dynamic_bitset<> uninitializedVariableAccesses;
 	};
-	map<CFGNode const*, NodeInfo> nodeInfos;
-	set<CFGNode const*> nodesToTraverse;
-	nodesToTraverse.insert(_entry);
+	vector<NodeInfo> nodeInfos(nodes.size(), NodeInfo{
+		boost::dynamic_bitset<>(variableIndices.size()),
+		boost::dynamic_bitset<>(variableIndices.size()),
+		boost::dynamic_bitset<>(accesses.size())
+	});
+	// Every reachable node has to be visited at least once.
+	set<size_t> nodesToTraverse;
+	for (size_t index = 0; index < nodes.size(); ++index)
+		nodesToTraverse.insert(index);
 
-	// Walk all paths starting from the nodes in ``nodesToTraverse`` until ``NodeInfo::propagateFrom``
-	// returns false for all exits, i.e. until all paths have been walked with maximal sets of unassigned
-	// variables and accesses.
+	// Propagate the unassigned variables and uninitialized accesses until a fixpoint is reached, i.e. until
+	// all paths have been walked with maximal sets of unassigned variables and accesses.
 	while (!nodesToTraverse.empty())
 	{
-		CFGNode const* currentNode = *nodesToTraverse.begin();
+		size_t currentIndex = *nodesToTraverse.begin();
 		nodesToTraverse.erase(nodesToTraverse.begin());
+		CFGNode const* currentNode = nodes[currentIndex];
 
-		auto& nodeInfo = nodeInfos[currentNode];
-		auto unassignedVariables = nodeInfo.unassignedVariablesAtEntry;
-		for (auto const& variableOccurrence: currentNode->variableOccurrences)
+		auto& nodeInfo = nodeInfos[currentIndex];
+		boost::dynamic_bitset<> unassignedVariables = nodeInfo.unassignedVariablesAtEntry;
+		for (size_t occurrenceIndex = 0; occurrenceIndex < currentNode->variableOccurrences.size(); ++occurrenceIndex)
 		{
+			VariableOccurrence const& variableOccurrence = currentNode->variableOccurrences[occurrenceIndex];
+			size_t index = occurrenceIndices[currentIndex][occurrenceIndex];
 			switch (variableOccurrence.kind())
 			{
 				case VariableOccurrence::Kind::Assignment:
-					unassignedVariables.erase(&variableOccurrence.declaration());
+					unassignedVariables.reset(index);
 					break;
 				case VariableOccurrence::Kind::InlineAssembly:
 					// We consider all variables referenced in inline assembly as accessed.
@@ -111,37 +150,48 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 					// the control flow in the assembly at some point.
 				case VariableOccurrence::Kind::Access:
 				case VariableOccurrence::Kind::Return:
-					if (unassignedVariables.count(&variableOccurrence.declaration()))
+				{
+					auto variable = variableIndices.find(&variableOccurrence.declaration());
+					if (variable != variableIndices.end() && unassignedVariables.test(variable->second))
 					{
 						// Merely store the unassigned access. We do not generate an error right away, since this
 						// path might still always revert. It is only an error if this is propagated to the exit
 						// node of the function (i.e. there is a path with an uninitialized access).
-						nodeInfo.uninitializedVariableAccesses.insert(&variableOccurrence);
+						nodeInfo.uninitializedVariableAccesses.set(index);
 					}
 					break;
+				}
 				case VariableOccurrence::Kind::Declaration:
-					unassignedVariables.insert(&variableOccurrence.declaration());
+					unassignedVariables.set(index);
 					break;
 			}
 		}
 		nodeInfo.unassignedVariablesAtExit = std::move(unassignedVariables);
 
 		// Propagate changes to all exits and queue them for traversal, if needed.
-		for (auto const& exit: currentNode->exits)
+		for (CFGNode const* exit: currentNode->exits)
+		{
+			size_t exitIndex = nodeIndices.at(exit);
+			NodeInfo& exitInfo = nodeInfos[exitIndex];
 			if (
-				auto exists = util::valueOrNullptr(nodeInfos, exit);
-				nodeInfos[exit].propagateFrom(nodeInfo) || !exists
+				!nodeInfo.unassignedVariablesAtExit.is_subset_of(exitInfo.unassignedVariablesAtEntry) ||
+				!nodeInfo.uninitializedVariableAccesses.is_subset_of(exitInfo.uninitializedVariableAccesses)
 			)
-				nodesToTraverse.insert(exit);
+			{
+				exitInfo.unassignedVariablesAtEntry |= nodeInfo.unassignedVariablesAtExit;
+				exitInfo.uninitializedVariableAccesses |= nodeInfo.uninitializedVariableAccesses;
+				nodesToTraverse.insert(exitIndex);
+			}
+		}
 	}
 
-	auto const& exitInfo = nodeInfos[_exit];
-	if (!exitInfo.uninitializedVariableAccesses.empty())
+	auto exitNode = nodeIndices.find(_exit);
+	if (exitNode != nodeIndices.end() && nodeInfos[exitNode->second].uninitializedVariableAccesses.any())
 	{
-		vector<VariableOccurrence const*> uninitializedAccessesOrdered(
-			exitInfo.uninitializedVariableAccesses.begin(),
-			exitInfo.uninitializedVariableAccesses.end()
-		);
+		auto const& exitAccesses = nodeInfos[exitNode->second].uninitializedVariableAccesses;
+		vector<VariableOccurrence const*> uninitializedAccessesOrdered;
+		for (size_t index = exitAccesses.find_first(); index != boost::dynamic_bitset<>::npos; index = exitAccesses.find_next(index))
+			uninitializedAccessesOrdered.push_back(accesses[index]);
 		ranges::sort(
 			uninitializedAccessesOrdered,
 			[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
@@ -424,22 +424,25 @@ void NameAndTypeResolver::linearizeBaseContracts(ContractDefinition& _contract)
 	vector<ContractDefinition const*> result = cThreeMerge(input);
 	if (result.empty())
 		m_errorReporter.fatalTypeError(5005_error, _contract.location(), "Linearization of inheritance graph impossible");
-	_contract.annotation().linearizedBaseContracts = result;
+	_contract.annotation().linearizedBaseContracts = std::move(result);
 }
 
 template <class T>
 vector<T const*> NameAndTypeResolver::cThreeMerge(list<list<T const*>>& _toMerge)
 {
+	_toMerge.remove_if([](list<T const*> const& _bases) { return _bases.empty(); });
+
+	// number of occurrences of each element outside of the heads of the lists
+	map<T const*, size_t> tailOccurrences;
+	for (list<T const*> const& bases: _toMerge)
+		for (auto it = ++bases.begin(); it != bases.end(); ++it)
+			++tailOccurrences[*it];
+
 	// returns true iff _candidate appears only as last element of the lists
 	auto appearsOnlyAtHead = [&](T const* _candidate) -> bool
 	{
-		for (list<T const*> const& bases: _toMerge)
-		{
-			solAssert(!bases.empty(), "");
-			if (find(++bases.begin(), bases.end(), _candidate) != bases.end())
-				return false;
-		}
-		return true;
+		auto it = tailOccurrences.find(_candidate);
+		return it == tailOccurrences.end() || it->second == 0;
 	};
 	// returns the next candidate to append to the linearized list or nullptr on failure
 	auto nextCandidate = [&]() -> T const*
@@ -452,12 +455,17 @@ vector<T const*> NameAndTypeResolver::cThreeMerge(list<list<T const*>>& _toMerge
 		}
 		return nullptr;
 	};
-	// removes the given contract from all lists
+	// removes the given contract from all lists, it can only appear at their heads
 	auto removeCandidate = [&](T const* _candidate)
 	{
 		for (auto it = _toMerge.begin(); it != _toMerge.end();)
 		{
-			it->remove(_candidate);
+			if (it->front() == _candidate)
+			{
+				it->pop_front();
+				if (!it->empty())
+					--tailOccurrences[it->front()];
+			}
 			if (it->empty())
 				it = _toMerge.erase(it);
 			else
@@ -465,7 +473,6 @@ vector<T const*> NameAndTypeResolver::cThreeMerge(list<list<T const*>>& _toMerge
 		}
 	};
 
-	_toMerge.remove_if([](list<T const*> const& _bases) { return _bases.empty(); });
 	vector<T const*> result;
 	while (!_toMerge.empty())
 	{
@@ -925,19 +925,14 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedFunctions.count(&_contract))
+	auto it = m_inheritedFunctions.find(&_contract);
+	if (it == m_inheritedFunctions.end())
 	{
 		OverrideProxyBySignatureMultiSet result;
 
 		for (auto const* base: resolveDirectBaseContracts(_contract))
 		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
-			for (FunctionDefinition const* fun: base->definedFunctions())
-				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
-			for (VariableDeclaration const* var: base->stateVariables())
-				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
+			OverrideProxyBySignatureSet const& functionsInBase = definedFunctions(*base);
 
 			result += functionsInBase;
 
@@ -946,23 +941,22 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 					result.insert(func);
 		}
 
-		m_inheritedFunctions[&_contract] = result;
+		it = m_inheritedFunctions.emplace(&_contract, std::move(result)).first;
 	}
 
-	return m_inheritedFunctions[&_contract];
+	return it->second;
 }
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedModifiers.count(&_contract))
+	auto it = m_inheritedModifiers.find(&_contract);
+	if (it == m_inheritedModifiers.end())
 	{
 		OverrideProxyBySignatureMultiSet result;
 
 		for (auto const* base: resolveDirectBaseContracts(_contract))
 		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
-			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
+			OverrideProxyBySignatureSet modifiersInBase = definedModifiers(*base);
 
 			for (OverrideProxy const& mod: inheritedModifiers(*base))
 				modifiersInBase.insert(mod);
@@ -970,8 +964,42 @@ OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheri
 			result += modifiersInBase;
 		}
 
-		m_inheritedModifiers[&_contract] = result;
+		it = m_inheritedModifiers.emplace(&_contract, std::move(result)).first;
 	}
 
-	return m_inheritedModifiers[&_contract];
+	return it->second;
+}
+
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::definedFunctions(ContractDefinition const& _contract) const
+{
+	auto it = m_definedFunctions.find(&_contract);
+	if (it == m_definedFunctions.end())
+	{
+		OverrideProxyBySignatureSet result;
+		for (FunctionDefinition const* fun: _contract.definedFunctions())
+			if (!fun->isConstructor())
+				result.emplace(OverrideProxy{fun});
+		for (VariableDeclaration const* var: _contract.stateVariables())
+			if (var->isPublic())
+				result.emplace(OverrideProxy{var});
+
+		it = m_definedFunctions.emplace(&_contract, std::move(result)).first;
+	}
+
+	return it->second;
+}
+
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::definedModifiers(ContractDefinition const& _contract) const
+{
+	auto it = m_definedModifiers.find(&_contract);
+	if (it == m_definedModifiers.end())
+	{
+		OverrideProxyBySignatureSet result;
+		for (ModifierDefinition const* mod: _contract.functionModifiers())
+			result.emplace(OverrideProxy{mod});
+
+		it = m_definedModifiers.emplace(&_contract, std::move(result)).first;
+	}
+
+	return it->second;
 }
@@ -186,11 +186,21 @@ private:
 
 	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited);
 
+	using OverrideProxyBySignatureSet = std::set<OverrideProxy, OverrideProxy::CompareBySignature>;
+	/// @returns the functions (including public state variables) and modifiers defined in @a _contract itself.
+	/// The proxies are shared between all contracts deriving from @a _contract, so that their
+	/// override comparators are only computed once.
+	OverrideProxyBySignatureSet const& definedFunctions(ContractDefinition const& _contract) const;
+	OverrideProxyBySignatureSet const& definedModifiers(ContractDefinition const& _contract) const;
+
 	langutil::ErrorReporter& m_errorReporter;
 
 	/// Cache for inheritedFunctions().
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	/// Cache for definedFunctions() and definedModifiers().
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_definedFunctions;
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_definedModifiers;
 };
 
 }
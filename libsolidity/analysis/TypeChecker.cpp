@@ -216,8 +216,8 @@ TypePointers TypeChecker::typeCheckABIDecodeAndRetrieveReturnType(FunctionCall c
 
 	if (arguments.size() >= 1)
 		if (
-			!type(*arguments.front())->isImplicitlyConvertibleTo(*TypeProvider::bytesMemory()) &&
-			!type(*arguments.front())->isImplicitlyConvertibleTo(*TypeProvider::bytesCalldata())
+			!isImplicitlyConvertible(*type(*arguments.front()), *TypeProvider::bytesMemory()) &&
+			!isImplicitlyConvertible(*type(*arguments.front()), *TypeProvider::bytesCalldata())
 		)
 			m_errorReporter.typeError(
 				1956_error,
@@ -370,7 +370,7 @@ void TypeChecker::endVisit(InheritanceSpecifier const& _inheritance)
 		}
 		for (size_t i = 0; i < std::min(arguments->size(), parameterTypes.size()); ++i)
 		{
-			BoolResult result = type(*(*arguments)[i])->isImplicitlyConvertibleTo(*parameterTypes[i]);
+			BoolResult result = isImplicitlyConvertible(*type(*(*arguments)[i]), *parameterTypes[i]);
 			if (!result)
 				m_errorReporter.typeErrorConcatenateDescriptions(
 					9827_error,
@@ -779,7 +779,7 @@ void TypeChecker::visitManually(
 	}
 	for (size_t i = 0; i < arguments.size(); ++i)
 	{
-		BoolResult result = type(*arguments[i])->isImplicitlyConvertibleTo(*type(*(*parameters)[i]));
+		BoolResult result = isImplicitlyConvertible(*type(*arguments[i]), *type(*(*parameters)[i]));
 		if (!result)
 			m_errorReporter.typeErrorConcatenateDescriptions(
 				4649_error,
@@ -1280,7 +1280,7 @@ void TypeChecker::endVisit(Return const& _return)
 	else
 	{
 		Type const* expected = type(*params->parameters().front());
-		BoolResult result = type(*_return.expression())->isImplicitlyConvertibleTo(*expected);
+		BoolResult result = isImplicitlyConvertible(*type(*_return.expression()), *expected);
 		if (!result)
 			m_errorReporter.typeErrorConcatenateDescriptions(
 				6359_error,
@@ -1388,7 +1388,7 @@ bool TypeChecker::visit(VariableDeclarationStatement const& _statement)
 		solAssert(var.annotation().type, "");
 
 		var.accept(*this);
-		BoolResult result = valueComponentType->isImplicitlyConvertibleTo(*var.annotation().type);
+		BoolResult result = isImplicitlyConvertible(*valueComponentType, *var.annotation().type);
 		if (!result)
 		{
 			auto errorMsg = "Type " +
@@ -1488,7 +1488,7 @@ bool TypeChecker::visit(Conditional const& _conditional)
 		BOOST_THROW_EXCEPTION(FatalError());
 	else if (trueType && falseType)
 	{
-		commonType = Type::commonType(trueType, falseType);
+		commonType = cachedCommonType(trueType, falseType);
 
 		if (!commonType)
 		{
@@ -1597,7 +1597,8 @@ bool TypeChecker::visit(Assignment const& _assignment)
 	{
 		// compound assignment
 		_assignment.rightHandSide().accept(*this);
-		Type const* resultType = t->binaryOperatorResult(
+		Type const* resultType = cachedBinaryOperatorResult(
+			*t,
 			TokenTraits::AssignmentToBinaryOp(_assignment.assignmentOperator()),
 			type(_assignment.rightHandSide())
 		);
@@ -1682,7 +1683,7 @@ bool TypeChecker::visit(TupleExpression const& _tuple)
 				if (i == 0)
 					inlineArrayType = types[i]->mobileType();
 				else if (inlineArrayType)
-					inlineArrayType = Type::commonType(inlineArrayType, types[i]);
+					inlineArrayType = cachedCommonType(inlineArrayType, types[i]);
 			}
 			if (!*components[i]->annotation().isPure)
 				isPure = false;
@@ -1763,7 +1764,7 @@ void TypeChecker::endVisit(BinaryOperation const& _operation)
 {
 	Type const* leftType = type(_operation.leftExpression());
 	Type const* rightType = type(_operation.rightExpression());
-	TypeResult result = leftType->binaryOperatorResult(_operation.getOperator(), rightType);
+	TypeResult result = cachedBinaryOperatorResult(*leftType, _operation.getOperator(), rightType);
 	Type const* commonType = result.get();
 	if (!commonType)
 	{
@@ -2308,7 +2309,7 @@ void TypeChecker::typeCheckABIEncodeCallFunction(FunctionCall const& _functionCa
 	for (size_t i = 0; i < numParameters; i++)
 	{
 		Type const& argType = *type(*callArguments[i]);
-		BoolResult result = argType.isImplicitlyConvertibleTo(*externalFunctionType->parameterTypes()[i]);
+		BoolResult result = isImplicitlyConvertible(argType, *externalFunctionType->parameterTypes()[i]);
 		if (!result)
 			m_errorReporter.typeError(
 				5407_error,
@@ -2340,7 +2341,7 @@ void TypeChecker::typeCheckStringConcatFunction(
 	for (shared_ptr<Expression const> const& argument: _functionCall.arguments())
 	{
 		Type const* argumentType = type(*argument);
-		bool notConvertibleToString = !argumentType->isImplicitlyConvertibleTo(*TypeProvider::stringMemory());
+		bool notConvertibleToString = !isImplicitlyConvertible(*argumentType, *TypeProvider::stringMemory());
 
 		if (notConvertibleToString)
 			m_errorReporter.typeError(
@@ -2368,8 +2369,8 @@ void TypeChecker::typeCheckBytesConcatFunction(
 	{
 		Type const* argumentType = type(*argument);
 		bool notConvertibleToBytes =
-			!argumentType->isImplicitlyConvertibleTo(*TypeProvider::fixedBytes(32)) &&
-			!argumentType->isImplicitlyConvertibleTo(*TypeProvider::bytesMemory());
+			!isImplicitlyConvertible(*argumentType, *TypeProvider::fixedBytes(32)) &&
+			!isImplicitlyConvertible(*argumentType, *TypeProvider::bytesMemory());
 		bool numberLiteral = (dynamic_cast<RationalNumberType const*>(argumentType) != nullptr);
 
 		if (notConvertibleToBytes || numberLiteral)
@@ -2556,7 +2557,7 @@ void TypeChecker::typeCheckFunctionGeneralChecks(
 	for (size_t i = 0; i < paramArgMap.size(); ++i)
 	{
 		solAssert(!!paramArgMap[i], "unmapped parameter");
-		BoolResult result = type(*paramArgMap[i])->isImplicitlyConvertibleTo(*parameterTypes[i]);
+		BoolResult result = isImplicitlyConvertible(*type(*paramArgMap[i]), *parameterTypes[i]);
 		if (!result)
 		{
 			auto [errorId, description] = [&]() -> tuple<ErrorId, string> {
@@ -3936,7 +3937,7 @@ Declaration const& TypeChecker::dereference(IdentifierPath const& _path) const
 bool TypeChecker::expectType(Expression const& _expression, Type const& _expectedType)
 {
 	_expression.accept(*this);
-	BoolResult result = type(_expression)->isImplicitlyConvertibleTo(_expectedType);
+	BoolResult result = isImplicitlyConvertible(*type(_expression), _expectedType);
 	if (!result)
 	{
 		auto errorMsg = "Type " +
@@ -4031,3 +4032,30 @@ bool TypeChecker::useABICoderV2() const
 	return *m_currentSourceUnit->annotation().useABICoderV2;
 
 }
+
+BoolResult TypeChecker::isImplicitlyConvertible(Type const& _from, Type const& _to)
+{
+	auto key = make_pair(&_from, &_to);
+	auto it = m_implicitConversions.find(key);
+	if (it == m_implicitConversions.end())
+		it = m_implicitConversions.emplace(key, _from.isImplicitlyConvertibleTo(_to)).first;
+	return it->second;
+}
+
+Type const* TypeChecker::cachedCommonType(Type const* _a, Type const* _b)
+{
+	auto key = make_pair(_a, _b);
+	auto it = m_commonTypes.find(key);
+	if (it == m_commonTypes.end())
+		it = m_commonTypes.emplace(key, Type::commonType(_a, _b)).first;
+	return it->second;
+}
+
+TypeResult TypeChecker::cachedBinaryOperatorResult(Type const& _left, Token _operator, Type const* _right)
+{
+	auto key = make_tuple(&_left, _operator, _right);
+	auto it = m_binaryOperatorResults.find(key);
+	if (it == m_binaryOperatorResults.end())
+		it = m_binaryOperatorResults.emplace(key, _left.binaryOperatorResult(_operator, _right)).first;
+	return it->second;
+}
@@ -30,6 +30,9 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/Types.h>
 
+#include <map>
+#include <tuple>
+
 namespace solidity::langutil
 {
 class ErrorReporter;
@@ -187,6 +190,13 @@ private:
 
 	bool useABICoderV2() const;
 
+	/// Memoised versions of Type::isImplicitlyConvertibleTo, Type::commonType and
+	/// Type::binaryOperatorResult. The memo tables are keyed by type identity, which is only sound
+	/// for types owned by the TypeProvider, i.e. not for temporaries.
+	BoolResult isImplicitlyConvertible(Type const& _from, Type const& _to);
+	Type const* cachedCommonType(Type const* _a, Type const* _b);
+	TypeResult cachedBinaryOperatorResult(Type const& _left, Token _operator, Type const* _right);
+
 	/// @returns the current scope that can have function or type definitions.
 	/// This is either a contract or a source unit.
 	ASTNode const* currentDefinitionScope() const
@@ -203,6 +213,10 @@ private:
 	langutil::EVMVersion m_evmVersion;
 
 	langutil::ErrorReporter& m_errorReporter;
+
+	std::map<std::pair<Type const*, Type const*>, BoolResult> m_implicitConversions;
+	std::map<std::pair<Type const*, Type const*>, Type const*> m_commonTypes;
+	std::map<std::tuple<Type const*, Token, Type const*>, TypeResult> m_binaryOperatorResults;
 };
 
 }
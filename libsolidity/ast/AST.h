@@ -122,7 +122,9 @@ public:
 	///@}
 
 protected:
-	size_t const m_id = 0;
+	friend class Parser;
+
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
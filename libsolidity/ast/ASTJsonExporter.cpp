@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <limits>
 #include <type_traits>
+#include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/map.hpp>
 
 using namespace std;
@@ -201,7 +202,55 @@ Json::Value ASTJsonExporter::inlineAssemblyIdentifierToJson(pair<yul::Identifier
 
 void ASTJsonExporter::print(ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format)
 {
-	_stream << util::jsonPrint(toJson(_node), _format);
+	if (_format.format == util::JsonFormat::Compact)
+		printCompact(_stream, _node);
+	else
+		_stream << util::jsonPrint(toJson(_node), _format);
+}
+
+void ASTJsonExporter::printCompact(ostream& _stream, ASTNode const& _node)
+{
+	vector<ASTPointer<ASTNode>> children;
+	if (auto const* sourceUnit = dynamic_cast<SourceUnit const*>(&_node))
+		children = sourceUnit->nodes();
+	else if (auto const* contract = dynamic_cast<ContractDefinition const*>(&_node))
+		children = contract->subNodes();
+	else
+	{
+		_stream << util::jsonCompactPrint(toJson(_node));
+		return;
+	}
+
+	m_shallowNode = &_node;
+	Json::Value json = toJson(_node);
+	m_shallowNode = nullptr;
+
+	// Members are written in the same order as the JSON writer uses, i.e. sorted by name.
+	vector<string> const names = json.getMemberNames();
+	_stream << "{";
+	for (auto&& [index, name]: names | ranges::views::enumerate)
+	{
+		if (index > 0)
+			_stream << ",";
+		_stream << util::jsonCompactPrint(Json::Value(name)) << ":";
+		if (name == "nodes")
+		{
+			_stream << "[";
+			for (auto&& [childIndex, child]: children | ranges::views::enumerate)
+			{
+				if (childIndex > 0)
+					_stream << ",";
+				if (child)
+					printCompact(_stream, *child);
+				else
+					_stream << "null";
+			}
+			_stream << "]";
+		}
+		else
+			_stream << util::jsonCompactPrint(json[name]);
+	}
+	_stream << "}";
 }
 
 Json::Value ASTJsonExporter::toJson(ASTNode const& _node)
@@ -214,7 +263,7 @@ bool ASTJsonExporter::visit(SourceUnit const& _node)
 {
 	std::vector<pair<string, Json::Value>> attributes = {
 		make_pair("license", _node.licenseString() ? Json::Value(*_node.licenseString()) : Json::nullValue),
-		make_pair("nodes", toJson(_node.nodes()))
+		make_pair("nodes", &_node == m_shallowNode ? Json::Value(Json::arrayValue) : toJson(_node.nodes()))
 	};
 
 	if (_node.annotation().exportedSymbols.set())
@@ -287,7 +336,7 @@ bool ASTJsonExporter::visit(ContractDefinition const& _node)
 		make_pair("baseContracts", toJson(_node.baseContracts())),
 		make_pair("contractDependencies", getContainerIds(_node.annotation().contractDependencies | ranges::views::keys)),
 		make_pair("usedErrors", getContainerIds(_node.interfaceErrors(false))),
-		make_pair("nodes", toJson(_node.subNodes())),
+		make_pair("nodes", &_node == m_shallowNode ? Json::Value(Json::arrayValue) : toJson(_node.subNodes())),
 		make_pair("scope", idOrNull(_node.scope()))
 	};
 	addIfSet(attributes, "canonicalName", _node.annotation().canonicalName);
@@ -59,6 +59,8 @@ public:
 		std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()
 	);
 	/// Output the json representation of the AST to _stream.
+	/// In compact format, the children of source units and contracts are converted and written
+	/// one at a time instead of building the JSON value of the whole tree first.
 	void print(std::ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format);
 	Json::Value toJson(ASTNode const& _node);
 	template <class T>
@@ -131,6 +133,9 @@ public:
 	void endVisit(EventDefinition const&) override;
 
 private:
+	/// Writes the compact json representation of @a _node to @a _stream, streaming the
+	/// "nodes" member of source units and contracts.
+	void printCompact(std::ostream& _stream, ASTNode const& _node);
 	void setJsonNode(
 		ASTNode const& _node,
 		std::string const& _nodeName,
@@ -198,6 +203,7 @@ private:
 
 	CompilerStack::State m_stackState = CompilerStack::State::Empty; ///< Used to only access information that already exists
 	bool m_inEvent = false; ///< whether we are currently inside an event or not
+	ASTNode const* m_shallowNode = nullptr; ///< source unit or contract whose "nodes" are omitted because they are streamed
 	Json::Value m_currentValue;
 	std::map<std::string, unsigned> m_sourceIndices;
 };
@@ -1046,10 +1046,12 @@ ASTPointer<StructuredDocumentation> ASTJsonImporter::createDocumentation(Json::V
 
 // ===== helper functions ==========
 
-Json::Value ASTJsonImporter::member(Json::Value const& _node, string const& _name)
+Json::Value const& ASTJsonImporter::member(Json::Value const& _node, string const& _name)
 {
+	// Returning a reference avoids copying the whole subtree of every member that is converted.
+	static Json::Value const nullValue;
 	if (!_node.isMember(_name))
-		return Json::nullValue;
+		return nullValue;
 	return _node[_name];
 }
 
@@ -1068,14 +1070,14 @@ ASTPointer<ASTString> ASTJsonImporter::nullOrASTString(Json::Value const& _json,
 
 ASTPointer<ASTString> ASTJsonImporter::memberAsASTString(Json::Value const& _node, string const& _name)
 {
-	Json::Value value = member(_node, _name);
+	Json::Value const& value = member(_node, _name);
 	astAssert(value.isString(), "field " + _name + " must be of type string.");
 	return make_shared<ASTString>(_node[_name].asString());
 }
 
 bool ASTJsonImporter::memberAsBool(Json::Value const& _node, string const& _name)
 {
-	Json::Value value = member(_node, _name);
+	Json::Value const& value = member(_node, _name);
 	astAssert(value.isBool(), "field " + _name + " must be of type boolean.");
 	return _node[_name].asBool();
 }
@@ -1119,7 +1121,7 @@ Token ASTJsonImporter::literalTokenKind(Json::Value const& _node)
 
 Visibility ASTJsonImporter::visibility(Json::Value const& _node)
 {
-	Json::Value visibility = member(_node, "visibility");
+	Json::Value const& visibility = member(_node, "visibility");
 	astAssert(visibility.isString(), "'visibility' expected to be a string.");
 
 	string const visibilityStr = visibility.asString();
@@ -1143,7 +1145,7 @@ Visibility ASTJsonImporter::visibility(Json::Value const& _node)
 
 VariableDeclaration::Location ASTJsonImporter::location(Json::Value const& _node)
 {
-	Json::Value storageLoc = member(_node, "storageLocation");
+	Json::Value const& storageLoc = member(_node, "storageLocation");
 	astAssert(storageLoc.isString(), "'storageLocation' expected to be a string.");
 
 	string const storageLocStr = storageLoc.asString();
@@ -1165,7 +1167,7 @@ VariableDeclaration::Location ASTJsonImporter::location(Json::Value const& _node
 
 Literal::SubDenomination ASTJsonImporter::subdenomination(Json::Value const& _node)
 {
-	Json::Value subDen = member(_node, "subdenomination");
+	Json::Value const& subDen = member(_node, "subdenomination");
 
 	if (subDen.isNull())
 		return Literal::SubDenomination::None;
@@ -192,6 +192,20 @@ void TypeProvider::reset()
 	clearCaches(instance().m_magics);
 
 	instance().m_generalTypes.clear();
+	instance().m_byteArrayTypes.clear();
+	instance().m_dynamicArrayTypes.clear();
+	instance().m_staticArrayTypes.clear();
+	instance().m_arraySliceTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_locationTypes.clear();
+	instance().m_contractTypes.clear();
+	instance().m_enumTypes.clear();
+	instance().m_moduleTypes.clear();
+	instance().m_typeTypes.clear();
+	instance().m_structTypes.clear();
+	instance().m_mappingTypes.clear();
+	instance().m_userDefinedValueTypes.clear();
+	instance().m_rationalNumberTypes.clear();
 	instance().m_stringLiteralTypes.clear();
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
@@ -204,6 +218,19 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createUniqueAndGet(
+	map<Key, T const*>& _types,
+	typename map<Key, T const*>::key_type _key,
+	Args&& ... _args
+)
+{
+	auto [it, inserted] = _types.try_emplace(std::move(_key), nullptr);
+	if (inserted)
+		it->second = createAndGet<T>(std::forward<Args>(_args)...);
+	return it->second;
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -404,7 +431,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(std::move(members));
+	return createUniqueAndGet(instance().m_tupleTypes, members, std::move(members));
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,8 +439,13 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto [it, inserted] = instance().m_locationTypes.try_emplace(tuple{_type, _location, _isPointer}, nullptr);
+	if (inserted)
+	{
+		instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
+		it->second = static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	}
+	return it->second;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
@@ -485,7 +517,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createUniqueAndGet(instance().m_rationalNumberTypes, {_value, _compatibleBytesType}, _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -504,47 +536,47 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createUniqueAndGet(instance().m_byteArrayTypes, {_location, _isString}, _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createUniqueAndGet(instance().m_dynamicArrayTypes, {_location, _baseType}, _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createUniqueAndGet(instance().m_staticArrayTypes, {_location, _baseType, _length}, _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createUniqueAndGet(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createUniqueAndGet(instance().m_contractTypes, {&_contractDef, _isSuper}, _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createUniqueAndGet(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createUniqueAndGet(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createUniqueAndGet(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createUniqueAndGet(instance().m_structTypes, {&_struct, _location}, _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
@@ -573,10 +605,17 @@ MagicType const* TypeProvider::meta(Type const* _type)
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, ASTString _keyName, Type const* _valueType, ASTString _valueName)
 {
-	return createAndGet<MappingType>(_keyType, _keyName, _valueType, _valueName);
+	return createUniqueAndGet(
+		instance().m_mappingTypes,
+		{_keyType, _keyName, _valueType, _valueName},
+		_keyType,
+		_keyName,
+		_valueType,
+		_valueName
+	);
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
 {
-	return createAndGet<UserDefinedValueType>(_definition);
+	return createUniqueAndGet(instance().m_userDefinedValueTypes, &_definition, _definition);
 }
@@ -24,7 +24,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -210,6 +212,16 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// Like @a createAndGet, but returns the type previously created for the same @a _key, if any.
+	/// The key has to determine the constructed type completely, so that types which are equal
+	/// are usually also identical and can be compared by pointer.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createUniqueAndGet(
+		std::map<Key, T const*>& _types,
+		typename std::map<Key, T const*>::key_type _key,
+		Args&& ... _args
+	);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -232,6 +244,22 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// Lookup tables for the hash-consed types in @a m_generalTypes, keyed by their construction arguments.
+	std::map<std::pair<DataLocation, bool>, ArrayType const*> m_byteArrayTypes{};
+	std::map<std::pair<DataLocation, Type const*>, ArrayType const*> m_dynamicArrayTypes{};
+	std::map<std::tuple<DataLocation, Type const*, u256>, ArrayType const*> m_staticArrayTypes{};
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySliceTypes{};
+	std::map<std::vector<Type const*>, TupleType const*> m_tupleTypes{};
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, ReferenceType const*> m_locationTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, ContractType const*> m_contractTypes{};
+	std::map<EnumDefinition const*, EnumType const*> m_enumTypes{};
+	std::map<SourceUnit const*, ModuleType const*> m_moduleTypes{};
+	std::map<Type const*, TypeType const*> m_typeTypes{};
+	std::map<std::pair<StructDefinition const*, DataLocation>, StructType const*> m_structTypes{};
+	std::map<std::tuple<Type const*, ASTString, Type const*, ASTString>, MappingType const*> m_mappingTypes{};
+	std::map<UserDefinedValueTypeDefinition const*, UserDefinedValueType const*> m_userDefinedValueTypes{};
+	std::map<std::pair<rational, Type const*>, RationalNumberType const*> m_rationalNumberTypes{};
 };
 
 }
@@ -135,6 +135,7 @@ MemberList::Member::Member(Declaration const* _declaration, Type const* _type, s
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_nativeMembers.reset();
 	m_stackItems.reset();
 	m_stackSize.reset();
 }
@@ -184,6 +185,7 @@ pair<u256, unsigned> const* StorageOffsets::offset(size_t _index) const
 void MemberList::combine(MemberList const & _other)
 {
 	m_memberTypes += _other.m_memberTypes;
+	m_memberIndices.reset();
 }
 
 pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
@@ -201,6 +203,19 @@ u256 const& MemberList::storageSize() const
 	return storageOffsets().storageSize();
 }
 
+vector<size_t> const& MemberList::memberIndices(string const& _name) const
+{
+	static vector<size_t> const noMembers;
+	if (!m_memberIndices)
+	{
+		m_memberIndices = make_unique<map<string, vector<size_t>, less<>>>();
+		for (auto&& [index, member]: m_memberTypes | ranges::views::enumerate)
+			(*m_memberIndices)[member.name].push_back(index);
+	}
+	auto it = m_memberIndices->find(_name);
+	return it == m_memberIndices->end() ? noMembers : it->second;
+}
+
 StorageOffsets const& MemberList::storageOffsets() const {
 	return m_storageOffsets.init([&]{
 		TypePointers memberTypes;
@@ -303,10 +318,22 @@ MemberList const& Type::members(ASTNode const* _currentScope) const
 			dynamic_cast<SourceUnit const*>(_currentScope) ||
 			dynamic_cast<ContractDefinition const*>(_currentScope),
 		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
+		MemberList::MemberMap attached;
 		if (_currentScope)
-			members += attachedFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(std::move(members));
+			attached = attachedFunctions(*this, *_currentScope);
+		if (nativeMembersDependOnScope())
+			m_members[_currentScope] = make_shared<MemberList>(nativeMembers(_currentScope) + std::move(attached));
+		else
+		{
+			if (!m_nativeMembers)
+				m_nativeMembers = make_shared<MemberList>(nativeMembers(nullptr));
+			if (attached.empty())
+				m_members[_currentScope] = m_nativeMembers;
+			else
+				m_members[_currentScope] = make_shared<MemberList>(
+					MemberList::MemberMap(m_nativeMembers->begin(), m_nativeMembers->end()) + std::move(attached)
+				);
+		}
 	}
 	return *m_members[_currentScope];
 }
@@ -1652,6 +1679,8 @@ string ArrayType::richIdentifier() const
 
 bool ArrayType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	ArrayType const& other = dynamic_cast<ArrayType const&>(_other);
@@ -3758,6 +3787,8 @@ string MappingType::richIdentifier() const
 
 bool MappingType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
@@ -3809,6 +3840,8 @@ string TypeType::richIdentifier() const
 
 bool TypeType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	TypeType const& other = dynamic_cast<TypeType const&>(_other);
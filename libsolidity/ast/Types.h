@@ -124,21 +124,17 @@ public:
 	void combine(MemberList const& _other);
 	Type const* memberType(std::string const& _name) const
 	{
-		Type const* type = nullptr;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-			{
-				solAssert(!type, "Requested member type by non-unique name.");
-				type = it.type;
-			}
-		return type;
+		std::vector<size_t> const& indices = memberIndices(_name);
+		if (indices.empty())
+			return nullptr;
+		solAssert(indices.size() == 1, "Requested member type by non-unique name.");
+		return m_memberTypes[indices.front()].type;
 	}
 	MemberMap membersByName(std::string const& _name) const
 	{
 		MemberMap members;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-				members.push_back(it);
+		for (size_t index: memberIndices(_name))
+			members.push_back(m_memberTypes[index]);
 		return members;
 	}
 	/// @returns the offset of the given member in storage slots and bytes inside a slot or
@@ -152,9 +148,15 @@ public:
 
 private:
 	StorageOffsets const& storageOffsets() const;
+	/// @returns the indices of the members called @a _name, using an index by name that is
+	/// built on first use.
+	std::vector<size_t> const& memberIndices(std::string const& _name) const;
 
 	MemberMap m_memberTypes;
 	util::LazyInit<StorageOffsets> m_storageOffsets;
+	/// Not a std::optional, because the move constructor of std::map is not noexcept on all platforms.
+	/// Not a util::LazyInit, because combine() has to discard it.
+	mutable std::unique_ptr<std::map<std::string, std::vector<size_t>, std::less<>>> m_memberIndices;
 };
 
 static_assert(std::is_nothrow_move_constructible<MemberList>::value, "MemberList should be noexcept move constructible");
@@ -388,6 +390,9 @@ protected:
 	{
 		return MemberList::MemberMap();
 	}
+	/// @returns true if the result of nativeMembers depends on the scope. Otherwise, the native
+	/// members are computed only once and shared between all scopes.
+	virtual bool nativeMembersDependOnScope() const { return false; }
 	/// Generates the stack items to be returned by ``stackItems()``. Defaults
 	/// to exactly one unnamed and untyped stack item referring to a single stack slot.
 	virtual std::vector<std::tuple<std::string, Type const*>> makeStackItems() const
@@ -397,7 +402,9 @@ protected:
 
 
 	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// Scopes without attached functions share the list of native members, if these do not depend on the scope.
+	mutable std::map<ASTNode const*, std::shared_ptr<MemberList const>> m_members;
+	mutable std::shared_ptr<MemberList const> m_nativeMembers;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
 };
@@ -1393,6 +1400,7 @@ public:
 	bool nameable() const override;
 	bool hasSimpleZeroValueInMemory() const override { return false; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 	Type const* encodingType() const override;
 	TypeResult interfaceType(bool _inLibrary) const override;
 	Type const* mobileType() const override;
@@ -1566,6 +1574,7 @@ public:
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	std::string toString(bool _withoutDataLocation) const override { return "type(" + m_actualType->toString(_withoutDataLocation) + ")"; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 protected:
@@ -30,6 +30,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -260,6 +262,64 @@ string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMemory)
 	});
 }
 
+string ABIFunctions::staticTupleDecoder(TypePointers const& _types, bool _fromMemory)
+{
+	bool onlyValueTypes = !_types.empty() && all_of(_types.begin(), _types.end(), [](Type const* _type) {
+		Type const* decodingType = _type->decodingType();
+		solAssert(decodingType, "");
+		// These are the types decoded by abiDecodingFunctionValueType.
+		return
+			!dynamic_cast<ArrayType const*>(decodingType) &&
+			!dynamic_cast<StructType const*>(decodingType) &&
+			!dynamic_cast<FunctionType const*>(decodingType);
+	});
+	if (!onlyValueTypes)
+		return tupleDecoder(_types, _fromMemory);
+
+	string functionName = string("abi_decode_static_tuple_");
+	for (auto const& t: _types)
+		functionName += t->identifier();
+	if (_fromMemory)
+		functionName += "_fromMemory";
+
+	return createFunction(functionName, [&]() {
+		Whiskers templ(R"(
+			function <functionName>(headStart, dataEnd) -> <values> {
+				if slt(sub(dataEnd, headStart), <size>) { <revertString>() }
+				<#elements>
+					<value> := <load>(<?+pos>add(headStart, <pos>)<!+pos>headStart</+pos>)
+				</elements>
+				<#elements>
+					<validator>(<value>)
+				</elements>
+			}
+		)");
+		templ("functionName", functionName);
+		templ("revertString", revertReasonIfDebugFunction("ABI decoding: tuple data too short"));
+		templ("size", to_string(32 * _types.size()));
+		templ("load", _fromMemory ? "mload" : "calldataload");
+
+		vector<map<string, string>> elements;
+		vector<string> values;
+		for (size_t i = 0; i < _types.size(); ++i)
+		{
+			solAssert(_types[i]->sizeOnStack() == 1, "");
+			solAssert(_types[i]->decodingType()->calldataHeadSize() == 32, "");
+			values.emplace_back("value" + to_string(i));
+			elements.push_back({
+				{"value", values.back()},
+				{"pos", i == 0 ? "" : to_string(32 * i)},
+				// Validation should use the type and not decodingType, because e.g.
+				// the decoding type of an enum is a plain int.
+				{"validator", m_utils.validatorFunction(*_types[i], true)}
+			});
+		}
+		templ("values", boost::algorithm::join(values, ", "));
+		templ("elements", std::move(elements));
+		return templ.render();
+	});
+}
+
 string ABIFunctions::EncodingOptions::toFunctionNameSuffix() const
 {
 	string suffix;
@@ -1536,7 +1596,7 @@ string ABIFunctions::arrayStoreLengthForEncodingFunction(ArrayType const& _type,
 
 string ABIFunctions::createFunction(string const& _name, function<string ()> const& _creator)
 {
-	return m_functionCollector.createFunction(_name, _creator);
+	return m_functionCollector.createSharedFunction(_name, _creator);
 }
 
 size_t ABIFunctions::headSize(TypePointers const& _targetTypes)
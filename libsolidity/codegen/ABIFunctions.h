@@ -125,6 +125,12 @@ public:
 	/// stack slot, it takes exactly that number of values.
 	std::string tupleDecoder(TypePointers const& _types, bool _fromMemory = false);
 
+	/// Variant of tupleDecoder for tuples that only consist of statically encoded value types:
+	/// After a single size check, all values are loaded from constant offsets and
+	/// validated afterwards, without calling a decoding function per element.
+	/// Falls back to tupleDecoder for all other tuples.
+	std::string staticTupleDecoder(TypePointers const& _types, bool _fromMemory = false);
+
 	struct EncodingOptions
 	{
 		/// Pad/signextend value types and bytes/string to multiples of 32 bytes.
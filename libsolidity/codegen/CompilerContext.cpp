@@ -62,6 +62,19 @@ using namespace solidity::evmasm;
 using namespace solidity::frontend;
 using namespace solidity::langutil;
 
+shared_ptr<YulUtilityCodeCache::Code const> YulUtilityCodeCache::find(Key const& _key) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_code.find(_key);
+	return it == m_code.end() ? nullptr : it->second;
+}
+
+void YulUtilityCodeCache::store(Key _key, shared_ptr<Code const> _code)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_code.try_emplace(std::move(_key), std::move(_code));
+}
+
 void CompilerContext::addStateVariable(
 	VariableDeclaration const& _declaration,
 	u256 const& _storageOffset,
@@ -434,6 +447,41 @@ void CompilerContext::appendInlineAssembly(
 		}
 	};
 
+	auto assemble = [&](yul::Block const& _block, yul::AsmAnalysisInfo& _analysisInfo) {
+		yul::CodeGenerator::assemble(
+			_block,
+			_analysisInfo,
+			*m_asm,
+			m_evmVersion,
+			identifierAccess.generateCode,
+			_system,
+			_optimiserSettings.optimizeStackAllocation
+		);
+
+		// Reset the source location to the one of the node (instead of the CODEGEN source location)
+		updateSourceLocation();
+	};
+
+	// Utility code does not depend on the contract, so other contracts requesting the same
+	// functions can reuse it.
+	optional<YulUtilityCodeCache::Key> cacheKey;
+	if (
+		_system &&
+		m_yulUtilityCodeCache &&
+		m_yulUtilityCodeCache->evmVersion() == m_evmVersion &&
+		m_yulUtilityCodeCache->optimiserSettings() == _optimiserSettings
+	)
+	{
+		cacheKey = YulUtilityCodeCache::Key{_assembly, _externallyUsedFunctions, runtimeContext() != nullptr};
+		if (auto cached = m_yulUtilityCodeCache->find(*cacheKey))
+		{
+			solAssert(m_generatedYulUtilityCode.empty(), "");
+			m_generatedYulUtilityCode = cached->source;
+			assemble(*cached->code, *cached->analysisInfo);
+			return;
+		}
+	}
+
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
 	langutil::CharStream charStream(_assembly, _sourceName);
@@ -518,18 +566,18 @@ void CompilerContext::appendInlineAssembly(
 		reportError("Failed to analyze inline assembly block.");
 
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
-	yul::CodeGenerator::assemble(
-		*parserResult,
-		analysisInfo,
-		*m_asm,
-		m_evmVersion,
-		identifierAccess.generateCode,
-		_system,
-		_optimiserSettings.optimizeStackAllocation
-	);
-
-	// Reset the source location to the one of the node (instead of the CODEGEN source location)
-	updateSourceLocation();
+	if (cacheKey)
+	{
+		auto code = make_shared<YulUtilityCodeCache::Code>(YulUtilityCodeCache::Code{
+			std::move(parserResult),
+			make_shared<yul::AsmAnalysisInfo>(std::move(analysisInfo)),
+			m_generatedYulUtilityCode
+		});
+		m_yulUtilityCodeCache->store(std::move(*cacheKey), code);
+		assemble(*code->code, *code->analysisInfo);
+	}
+	else
+		assemble(*parserResult, analysisInfo);
 }
 
 
@@ -549,7 +597,8 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _
 		_optimiserSettings.yulOptimiserSteps,
 		_optimiserSettings.yulOptimiserCleanupSteps,
 		isCreation? nullopt : make_optional(_optimiserSettings.expectedExecutionsPerDeployment),
-		_externalIdentifiers
+		_externalIdentifiers,
+		_optimiserSettings.preferRarelyUsedVariablesForMemory
 	);
 
 #ifdef SOL_OUTPUT_ASM
@@ -42,6 +42,7 @@
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <functional>
+#include <mutex>
 #include <ostream>
 #include <stack>
 #include <queue>
@@ -53,6 +54,43 @@ namespace solidity::frontend
 
 class Compiler;
 
+/**
+ * Thread-safe cache of parsed, analyzed and optimized Yul utility code, shared between
+ * the contracts of a compilation that request the same set of utility functions.
+ * The cached code is only valid for one EVM version and one set of optimiser settings.
+ */
+class YulUtilityCodeCache
+{
+public:
+	struct Code
+	{
+		std::shared_ptr<yul::Block const> code;
+		std::shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+		/// The (optimized) source the locations in @a code refer to.
+		std::string source;
+	};
+	/// The source of the utility functions, the functions used from outside and whether
+	/// the code is part of the creation code.
+	using Key = std::tuple<std::string, std::set<std::string>, bool>;
+
+	YulUtilityCodeCache(langutil::EVMVersion _evmVersion, OptimiserSettings _optimiserSettings):
+		m_evmVersion(_evmVersion),
+		m_optimiserSettings(std::move(_optimiserSettings))
+	{}
+
+	langutil::EVMVersion evmVersion() const { return m_evmVersion; }
+	OptimiserSettings const& optimiserSettings() const { return m_optimiserSettings; }
+
+	std::shared_ptr<Code const> find(Key const& _key) const;
+	void store(Key _key, std::shared_ptr<Code const> _code);
+
+private:
+	langutil::EVMVersion const m_evmVersion;
+	OptimiserSettings const m_optimiserSettings;
+	mutable std::mutex m_mutex;
+	std::map<Key, std::shared_ptr<Code const>> m_code;
+};
+
 /**
  * Context to be shared by all units that compile the same contract.
  * It stores the generated bytecode and the position of identifiers in memory and on the stack.
@@ -63,13 +101,15 @@ public:
 	explicit CompilerContext(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		CompilerContext* _runtimeContext = nullptr
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<YulUtilityCodeCache> _yulUtilityCodeCache = {}
 	):
 		m_asm(std::make_shared<evmasm::Assembly>(_evmVersion, _runtimeContext != nullptr, std::string{})),
 		m_evmVersion(_evmVersion),
 		m_revertStrings(_revertStrings),
 		m_reservedMemory{0},
 		m_runtimeContext(_runtimeContext),
+		m_yulUtilityCodeCache(std::move(_yulUtilityCodeCache)),
 		m_abiFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector),
 		m_yulUtilFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector)
 	{
@@ -382,6 +422,8 @@ private:
 	MultiUseYulFunctionCollector m_yulFunctionCollector;
 	/// Set of externally used yul functions.
 	std::set<std::string> m_externallyUsedYulFunctions;
+	/// Cache of the Yul utility code of other contracts of the compilation, may be null.
+	std::shared_ptr<YulUtilityCodeCache> m_yulUtilityCodeCache;
 	/// Generated Yul code used as utility. Source references from the bytecode can point here.
 	/// Produced from @a m_yulFunctionCollector.
 	std::string m_generatedYulUtilityCode;
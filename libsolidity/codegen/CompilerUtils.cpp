@@ -29,6 +29,7 @@
 #include <libsolidity/codegen/ArrayUtils.h>
 #include <libsolidity/codegen/LValue.h>
 #include <libsolutil/FunctionSelector.h>
+#include <libevmasm/GasMeter.h>
 #include <libevmasm/Instruction.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StackTooDeepString.h>
@@ -244,14 +245,14 @@ void CompilerUtils::storeInMemoryDynamic(Type const& _type, bool _padToWordBound
 	}
 }
 
-void CompilerUtils::abiDecode(TypePointers const& _typeParameters, bool _fromMemory)
+void CompilerUtils::abiDecode(TypePointers const& _typeParameters, bool _fromMemory, bool _staticTupleDecoder)
 {
 	/// Stack: <source_offset> <length>
 	if (m_context.useABICoderV2())
 	{
 		// Use the new Yul-based decoding function
 		auto stackHeightBefore = m_context.stackHeight();
-		abiDecodeV2(_typeParameters, _fromMemory);
+		abiDecodeV2(_typeParameters, _fromMemory, _staticTupleDecoder);
 		solAssert(m_context.stackHeight() - stackHeightBefore == sizeOnStack(_typeParameters) - 2);
 		return;
 	}
@@ -625,13 +626,16 @@ void CompilerUtils::abiEncodeV2(
 	m_context.callYulFunction(encoderName, sizeOnStack(_givenTypes) + 1, 1);
 }
 
-void CompilerUtils::abiDecodeV2(TypePointers const& _parameterTypes, bool _fromMemory)
+void CompilerUtils::abiDecodeV2(TypePointers const& _parameterTypes, bool _fromMemory, bool _staticTupleDecoder)
 {
 	// stack: <source_offset> <length> [stack top]
 	m_context << Instruction::DUP2 << Instruction::ADD;
 	m_context << Instruction::SWAP1;
 	// stack: <end> <start>
-	string decoderName = m_context.abiFunctions().tupleDecoder(_parameterTypes, _fromMemory);
+	string decoderName =
+		_staticTupleDecoder ?
+		m_context.abiFunctions().staticTupleDecoder(_parameterTypes, _fromMemory) :
+		m_context.abiFunctions().tupleDecoder(_parameterTypes, _fromMemory);
 	m_context.callYulFunction(decoderName, 2, sizeOnStack(_parameterTypes));
 }
 
@@ -1501,6 +1505,40 @@ unsigned CompilerUtils::sizeOnStack(vector<Type const*> const& _variableTypes)
 	return size;
 }
 
+bool CompilerUtils::splitFunctionSelection(size_t _numberOfFunctions, size_t _runs)
+{
+	// Code for selecting from n functions without split:
+	//   n times: dup1, push4 <id_i>, eq, push2/3 <tag_i>, jumpi
+	//   push2/3 <notfound> jump
+	// (called SELECT[n])
+	// Code for selecting from n functions with split:
+	//   dup1, push4 <pivot>, gt, push2/3<tag_less>, jumpi
+	//     SELECT[n/2]
+	//   tag_less:
+	//     SELECT[n/2]
+	//
+	// This means each split adds 16-18 bytes of additional code (note the additional jump out!)
+	// The average execution cost if we do not split at all are:
+	//   (3 + 3 + 3 + 3 + 10) * n/2 = 24 * n/2 = 12 * n
+	// If we split once:
+	//    (3 + 3 + 3 + 3 + 10) + 24 * n/4 = 24 * (n/4 + 1) = 6 * n + 24;
+	//
+	// We should split if
+	//     _runs * 12 * n > _runs * (6 * n + 24) + 17 * createDataGas
+	// <=> _runs * 6 * (n - 4) > 17 * createDataGas
+	//
+	// Which also means that the execution itself is not profitable
+	// unless we have at least 5 functions.
+
+	// Start with some comparisons to avoid overflow, then do the actual comparison.
+	if (_numberOfFunctions <= 4)
+		return false;
+	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
+		return true;
+	else
+		return _runs * 6 * (_numberOfFunctions - 4) > 17 * evmasm::GasCosts::createDataGas;
+}
+
 void CompilerUtils::computeHashStatic()
 {
 	storeInMemory(0);
@@ -127,9 +127,10 @@ public:
 	/// Calls revert if the supplied size is shorter than the static data requirements
 	/// or if dynamic data pointers reach outside of the area.
 	/// Also has a hard cap of 0x100000000 for any given length/offset field.
+	/// With ABI coder v2, uses ABIFunctions::staticTupleDecoder if @a _staticTupleDecoder is true.
 	/// Stack pre: <source_offset> <length>
 	/// Stack post: <value0> <value1> ... <valuen>
-	void abiDecode(TypePointers const& _typeParameters, bool _fromMemory = false);
+	void abiDecode(TypePointers const& _typeParameters, bool _fromMemory = false, bool _staticTupleDecoder = false);
 
 	/// Copies values (of types @a _givenTypes) given on the stack to a location in memory given
 	/// at the stack top, encoding them according to the ABI as the given types @a _targetTypes.
@@ -193,9 +194,10 @@ public:
 	/// Decodes data from ABI encoding into internal encoding. If @a _fromMemory is set to true,
 	/// the data is taken from memory instead of from calldata.
 	/// Can allocate memory.
+	/// Uses ABIFunctions::staticTupleDecoder if @a _staticTupleDecoder is true.
 	/// Stack pre: <source_offset> <length>
 	/// Stack post: <value0> <value1> ... <valuen>
-	void abiDecodeV2(TypePointers const& _parameterTypes, bool _fromMemory = false);
+	void abiDecodeV2(TypePointers const& _parameterTypes, bool _fromMemory = false, bool _staticTupleDecoder = false);
 
 	/// Zero-initialises (the data part of) an already allocated memory array.
 	/// Length has to be nonzero!
@@ -283,6 +285,12 @@ public:
 	static unsigned sizeOnStack(std::vector<T> const& _variables);
 	static unsigned sizeOnStack(std::vector<Type const*> const& _variableTypes);
 
+	/// @returns true if a function dispatcher selecting from @a _numberOfFunctions functions
+	/// should first compare the selector against a pivot and select from the two halves separately
+	/// instead of comparing the selector against each function selector in turn, assuming
+	/// @a _runs executions per deployment.
+	static bool splitFunctionSelection(size_t _numberOfFunctions, size_t _runs);
+
 	/// Helper function to shift top value on the stack to the left.
 	/// Stack pre: <value> <shift_by_bits>
 	/// Stack post: <shifted_value>
@@ -42,7 +42,6 @@
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/Assembly.h>
-#include <libevmasm/GasMeter.h>
 
 #include <liblangutil/ErrorReporter.h>
 
@@ -330,39 +329,7 @@ void ContractCompiler::appendInternalSelector(
 	size_t _runs
 )
 {
-	// Code for selecting from n functions without split:
-	//   n times: dup1, push4 <id_i>, eq, push2/3 <tag_i>, jumpi
-	//   push2/3 <notfound> jump
-	// (called SELECT[n])
-	// Code for selecting from n functions with split:
-	//   dup1, push4 <pivot>, gt, push2/3<tag_less>, jumpi
-	//     SELECT[n/2]
-	//   tag_less:
-	//     SELECT[n/2]
-	//
-	// This means each split adds 16-18 bytes of additional code (note the additional jump out!)
-	// The average execution cost if we do not split at all are:
-	//   (3 + 3 + 3 + 3 + 10) * n/2 = 24 * n/2 = 12 * n
-	// If we split once:
-	//    (3 + 3 + 3 + 3 + 10) + 24 * n/4 = 24 * (n/4 + 1) = 6 * n + 24;
-	//
-	// We should split if
-	//     _runs * 12 * n > _runs * (6 * n + 24) + 17 * createDataGas
-	// <=> _runs * 6 * (n - 4) > 17 * createDataGas
-	//
-	// Which also means that the execution itself is not profitable
-	// unless we have at least 5 functions.
-
-	// Start with some comparisons to avoid overflow, then do the actual comparison.
-	bool split = false;
-	if (_ids.size() <= 4)
-		split = false;
-	else if (_runs > (17 * evmasm::GasCosts::createDataGas) / 6)
-		split = true;
-	else
-		split = (_runs * 6 * (_ids.size() - 4) > 17 * evmasm::GasCosts::createDataGas);
-
-	if (split)
+	if (CompilerUtils::splitFunctionSelection(_ids.size(), _runs))
 	{
 		size_t pivotIndex = _ids.size() / 2;
 		FixedHash<4> pivot{_ids.at(pivotIndex)};
@@ -535,7 +502,11 @@ void ContractCompiler::appendFunctionSelector(ContractDefinition const& _contrac
 			// Parameter for calldataUnpacker
 			m_context << CompilerUtils::dataStartOffset;
 			m_context << Instruction::DUP1 << Instruction::CALLDATASIZE << Instruction::SUB;
-			CompilerUtils(m_context).abiDecode(functionType->parameterTypes());
+			CompilerUtils(m_context).abiDecode(
+				functionType->parameterTypes(),
+				false,
+				m_optimiserSettings.specializeStaticTupleDecoding
+			);
 		}
 		m_context.appendJumpTo(
 			m_context.functionEntryLabel(functionType->declaration()),
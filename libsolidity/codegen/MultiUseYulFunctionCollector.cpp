@@ -31,8 +31,49 @@ using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
+namespace
+{
+
+string functionWithParameters(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	vector<string> arguments;
+	vector<string> returnParameters;
+	string body = _creator(arguments, returnParameters);
+	solAssert(!body.empty(), "");
+
+	return Whiskers(R"(
+		function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
+			<body>
+		}
+	)")
+	("functionName", _name)
+	("args", joinHumanReadable(arguments))
+	("retParams", joinHumanReadable(returnParameters))
+	("body", body)
+	.render();
+}
+
+}
+
+SharedYulFunctions::Function const* SharedYulFunctions::find(string const& _name) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_functions.find(_name);
+	return it == m_functions.end() ? nullptr : &it->second;
+}
+
+void SharedYulFunctions::store(string const& _name, Function _function)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_functions.try_emplace(_name, std::move(_function));
+}
+
 string MultiUseYulFunctionCollector::requestedFunctions()
 {
+	solAssert(m_dependencies.empty(), "");
 	string result = std::move(m_code);
 	m_code.clear();
 	m_requestedFunctions.clear();
@@ -41,6 +82,9 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
+	// The code of the shared functions currently being created now depends on more than their names.
+	for (auto& dependencies: m_dependencies)
+		dependencies.reset();
 	if (!m_requestedFunctions.count(_name))
 	{
 		m_requestedFunctions.insert(_name);
@@ -58,24 +102,66 @@ string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
+	return createFunction(_name, [&]() { return functionWithParameters(_name, _creator); });
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(string const& _name, function<string ()> const& _creator)
+{
+	if (!m_sharedFunctions)
+		return createFunction(_name, _creator);
+
+	if (!m_dependencies.empty() && m_dependencies.back())
+		m_dependencies.back()->emplace_back(_name);
+	if (!m_requestedFunctions.count(_name) && !addStoredFunction(_name))
 	{
 		m_requestedFunctions.insert(_name);
-		vector<string> arguments;
-		vector<string> returnParameters;
-		string body = _creator(arguments, returnParameters);
-		solAssert(!body.empty(), "");
-
-		m_code += Whiskers(R"(
-			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
-				<body>
-			}
-		)")
-		("functionName", _name)
-		("args", joinHumanReadable(arguments))
-		("retParams", joinHumanReadable(returnParameters))
-		("body", body)
-		.render();
+		m_dependencies.emplace_back(vector<string>{});
+		string fun = _creator();
+		solAssert(!fun.empty(), "");
+		solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
+		solAssert(!m_dependencies.empty(), "");
+		if (m_dependencies.back())
+			m_sharedFunctions->store(_name, {fun, std::move(*m_dependencies.back())});
+		m_dependencies.pop_back();
+		m_code += std::move(fun);
 	}
 	return _name;
 }
+
+string MultiUseYulFunctionCollector::createSharedFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	solAssert(!_name.empty(), "");
+	return createSharedFunction(_name, [&]() { return functionWithParameters(_name, _creator); });
+}
+
+bool MultiUseYulFunctionCollector::addStoredFunction(string const& _name)
+{
+	vector<SharedYulFunctions::Function const*> functionsToAdd;
+	vector<string const*> namesToAdd;
+	set<string> visited;
+	function<bool(string const&)> collect = [&](string const& _function) {
+		SharedYulFunctions::Function const* stored = m_sharedFunctions->find(_function);
+		if (!stored)
+			return false;
+		visited.insert(_function);
+		for (string const& dependency: stored->dependencies)
+			if (!m_requestedFunctions.count(dependency) && !visited.count(dependency) && !collect(dependency))
+				return false;
+		// Like when creating the functions, dependencies are added before the functions requiring them.
+		functionsToAdd.emplace_back(stored);
+		namesToAdd.emplace_back(&_function);
+		return true;
+	};
+	if (!collect(_name))
+		return false;
+
+	for (size_t i = 0; i < functionsToAdd.size(); ++i)
+	{
+		m_requestedFunctions.insert(*namesToAdd[i]);
+		m_code += functionsToAdd[i]->code;
+	}
+	return true;
+}
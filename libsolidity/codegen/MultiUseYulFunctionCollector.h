@@ -24,12 +24,42 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
 
+/**
+ * Thread-safe store of Yul functions whose code only depends on their name and on settings
+ * that are the same for all contracts of a compilation (EVM version, revert strings),
+ * so that they are generated only once per compilation and not once per contract.
+ */
+class SharedYulFunctions
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of the functions requested while generating the function, in the order
+		/// in which they were requested.
+		std::vector<std::string> dependencies;
+	};
+
+	/// @returns the function with the given name or nullptr if it has not been stored yet.
+	/// The returned function stays valid as long as this object exists.
+	Function const* find(std::string const& _name) const;
+	void store(std::string const& _name, Function _function);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<std::string, Function> m_functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -37,6 +67,10 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<SharedYulFunctions> _sharedFunctions = {}):
+		m_sharedFunctions(std::move(_sharedFunctions))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +81,19 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Variants of createFunction for functions whose code only depends on their name and the
+	/// settings of the compilation. If a store of shared functions is set, the function is taken
+	/// from there together with all the functions it requires, if possible, and the function
+	/// is added to the store after it has been created otherwise.
+	std::string createSharedFunction(std::string const& _name, std::function<std::string()> const& _creator);
+
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
+	std::shared_ptr<SharedYulFunctions> const& sharedFunctions() const { return m_sharedFunctions; }
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -57,8 +104,17 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	/// Adds the shared function @a _name and all the functions it requires that have not been
+	/// requested yet, in the same order in which creating them would have added them.
+	/// @returns false and does not add anything if not all of them are stored.
+	bool addStoredFunction(std::string const& _name);
+
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+	std::shared_ptr<SharedYulFunctions> m_sharedFunctions;
+	/// Functions requested while creating each of the shared functions currently being created,
+	/// or nullopt if it cannot be stored because a function that is not shared was created.
+	std::vector<std::optional<std::vector<std::string>>> m_dependencies;
 };
 
 }
@@ -52,11 +52,13 @@ public:
 	explicit YulUtilFunctions(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		MultiUseYulFunctionCollector& _functionCollector
+		MultiUseYulFunctionCollector& _functionCollector,
+		bool _coalescePackedStorageWrites = false
 	):
 		m_evmVersion(_evmVersion),
 		m_revertStrings(_revertStrings),
-		m_functionCollector(_functionCollector)
+		m_functionCollector(_functionCollector),
+		m_coalescePackedStorageWrites(_coalescePackedStorageWrites)
 	{}
 
 	/// @returns the name of a function that returns its argument.
@@ -532,6 +534,8 @@ public:
 
 private:
 	/// @returns the name of a function that copies a struct from calldata or memory to storage
+	/// If packed storage writes are coalesced, consecutive value type members sharing a slot
+	/// are combined into a single sload and sstore.
 	/// signature: (slot, value) ->
 	std::string copyStructToStorageFunction(StructType const& _from, StructType const& _to);
 
@@ -606,6 +610,7 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	RevertStrings m_revertStrings;
 	MultiUseYulFunctionCollector& m_functionCollector;
+	bool m_coalescePackedStorageWrites = false;
 };
 
 }
@@ -25,6 +25,8 @@
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/ast/CallGraph.h>
 #include <libsolidity/ast/TypeProvider.h>
 
 #include <libsolutil/Whiskers.h>
@@ -37,6 +39,32 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 
+namespace
+{
+
+class InlineAssemblyFinder: private ASTConstVisitor
+{
+public:
+	static bool containsInlineAssembly(ASTNode const& _node)
+	{
+		InlineAssemblyFinder finder;
+		_node.accept(finder);
+		return finder.m_found;
+	}
+
+private:
+	bool visit(InlineAssembly const&) override
+	{
+		m_found = true;
+		return false;
+	}
+	bool visitNode(ASTNode const&) override { return !m_found; }
+
+	bool m_found = false;
+};
+
+}
+
 string IRGenerationContext::enqueueFunctionForCodeGeneration(FunctionDefinition const& _function)
 {
 	string name = IRNames::function(_function);
@@ -62,6 +90,41 @@ ContractDefinition const& IRGenerationContext::mostDerivedContract() const
 	return *m_mostDerivedContract;
 }
 
+bool IRGenerationContext::callMemoryReclaimable(FunctionDefinition const& _function)
+{
+	if (auto it = m_callMemoryReclaimable.find(&_function); it != m_callMemoryReclaimable.end())
+		return it->second;
+
+	bool reclaimable = true;
+	for (auto const& parameter: _function.parameters() + _function.returnParameters())
+		if (parameter->annotation().type->dataStoredIn(DataLocation::Memory))
+			reclaimable = false;
+
+	CallGraph const& callGraph = m_executionContext == ExecutionContext::Creation ?
+		**mostDerivedContract().annotation().creationCallGraph :
+		**mostDerivedContract().annotation().deployedCallGraph;
+	set<CallGraph::Node, CallGraph::CompareByID> visited;
+	vector<CallGraph::Node> toVisit{&_function};
+	while (reclaimable && !toVisit.empty())
+	{
+		CallGraph::Node node = toVisit.back();
+		toVisit.pop_back();
+		if (!visited.insert(node).second)
+			continue;
+
+		// Callables missing from the graph are treated conservatively.
+		auto edges = callGraph.edges.find(node);
+		if (auto const* callable = get_if<CallableDeclaration const*>(&node))
+			if (edges == callGraph.edges.end() || InlineAssemblyFinder::containsInlineAssembly(**callable))
+				reclaimable = false;
+		if (edges != callGraph.edges.end())
+			toVisit += edges->second;
+	}
+
+	m_callMemoryReclaimable[&_function] = reclaimable;
+	return reclaimable;
+}
+
 IRVariable const& IRGenerationContext::addLocalVariable(VariableDeclaration const& _varDecl)
 {
 	auto const& [it, didInsert] = m_localVariables.emplace(
@@ -170,7 +233,12 @@ void IRGenerationContext::internalFunctionCalledThroughDispatch(YulArity const&
 
 YulUtilFunctions IRGenerationContext::utils()
 {
-	return YulUtilFunctions(m_evmVersion, m_revertStrings, m_functions);
+	return YulUtilFunctions(
+		m_evmVersion,
+		m_revertStrings,
+		m_functions,
+		m_optimiserSettings.coalescePackedStorageWrites
+	);
 }
 
 ABIFunctions IRGenerationContext::abiFunctions()
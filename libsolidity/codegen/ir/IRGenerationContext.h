@@ -76,13 +76,15 @@ public:
 		OptimiserSettings _optimiserSettings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<SharedYulFunctions> _sharedFunctions = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_executionContext(_executionContext),
 		m_revertStrings(_revertStrings),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_sourceIndices(std::move(_sourceIndices)),
+		m_functions(std::move(_sharedFunctions)),
 		m_debugInfoSelection(_debugInfoSelection),
 		m_soliditySourceProvider(_soliditySourceProvider)
 	{}
@@ -163,6 +165,14 @@ public:
 	bool memoryUnsafeInlineAssemblySeen() const { return m_memoryUnsafeInlineAssemblySeen; }
 	void setMemoryUnsafeInlineAssemblySeen() { m_memoryUnsafeInlineAssemblySeen = true; }
 
+	OptimiserSettings const& optimiserSettings() const { return m_optimiserSettings; }
+
+	/// @returns true if no memory allocated during a call to @a _function can be referenced once
+	/// the call returns, so that the free memory pointer can be reset to its value before the call.
+	/// This is the case if the function neither takes nor returns memory objects and neither
+	/// the function nor anything it may call in the current execution context contains inline assembly.
+	bool callMemoryReclaimable(FunctionDefinition const& _function);
+
 	/// @returns the runtime ID to be used for the function in the dispatch routine
 	/// and for internal function pointers.
 	/// @param _requirePresent if false, generates a new ID if not yet done.
@@ -204,6 +214,8 @@ private:
 
 	/// Flag indicating whether any memory-unsafe inline assembly block was seen.
 	bool m_memoryUnsafeInlineAssemblySeen = false;
+	/// Cached results of callMemoryReclaimable().
+	std::map<FunctionDefinition const*, bool> m_callMemoryReclaimable;
 
 	/// Function definitions queued for code generation. They're the Solidity functions whose calls
 	/// were discovered by the IR generator during AST traversal.
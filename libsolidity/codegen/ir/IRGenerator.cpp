@@ -87,13 +87,24 @@ set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCallables(
 
 }
 
-pair<string, string> IRGenerator::run(
+tuple<string, string, shared_ptr<yul::Object>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	map<ContractDefinition const*, string_view const> const& _otherYulSources,
+	map<ContractDefinition const*, shared_ptr<yul::Object>> const& _otherYulObjects,
+	bool _printUnoptimized,
+	bool _printOptimized
 )
 {
-	string ir = yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+	auto [code, subObjects, codeWithSubObjects] = generate(
+		_contract,
+		_cborMetadata,
+		_otherYulSources,
+		_otherYulObjects,
+		_printUnoptimized
+	);
+	// Only the printed form is reindented, the parser does not depend on the indentation.
+	string ir = codeWithSubObjects ? yul::reindent(*codeWithSubObjects) : string{};
 
 	yul::YulStack asmStack(
 		m_evmVersion,
@@ -102,7 +113,8 @@ pair<string, string> IRGenerator::run(
 		m_optimiserSettings,
 		m_context.debugInfoSelection()
 	);
-	if (!asmStack.parseAndAnalyze("", ir))
+	// The objects of created contracts are already optimized and do not have to be parsed again.
+	if (!asmStack.parseAndAnalyze("", code, std::move(subObjects)))
 	{
 		string errorMessage;
 		for (auto const& error: asmStack.errors())
@@ -110,17 +122,20 @@ pair<string, string> IRGenerator::run(
 				*error,
 				asmStack.charStream("")
 			);
-		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
+		solAssert(false, code + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
 	}
 	asmStack.optimize();
 
-	return {std::move(ir), asmStack.print(m_context.soliditySourceProvider())};
+	string optimizedIR = _printOptimized ? asmStack.print(m_context.soliditySourceProvider()) : string{};
+	return {std::move(ir), std::move(optimizedIR), asmStack.parserResult()};
 }
 
-string IRGenerator::generate(
+tuple<string, map<string, vector<shared_ptr<yul::Object>>>, optional<string>> IRGenerator::generate(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	map<ContractDefinition const*, string_view const> const& _otherYulSources,
+	map<ContractDefinition const*, shared_ptr<yul::Object>> const& _otherYulObjects,
+	bool _withSubObjectSources
 )
 {
 	auto subObjectSources = [&_otherYulSources](std::set<ContractDefinition const*, ASTNode::CompareByID> const& subObjects) -> string
@@ -203,7 +218,7 @@ string IRGenerator::generate(
 	InternalDispatchMap internalDispatchMap = generateInternalDispatchFunctions(_contract);
 
 	t("functions", m_context.functionCollector().requestedFunctions());
-	t("subObjects", subObjectSources(m_context.subObjectsCreated()));
+	auto const creationSubObjects = m_context.subObjectsCreated();
 
 	// This has to be called only after all other code generation for the creation object is complete.
 	bool creationInvolvesMemoryUnsafeAssembly = m_context.memoryUnsafeInlineAssemblySeen();
@@ -225,7 +240,7 @@ string IRGenerator::generate(
 	set<FunctionDefinition const*> deployedFunctionList = generateQueuedFunctions();
 	generateInternalDispatchFunctions(_contract);
 	t("deployedFunctions", m_context.functionCollector().requestedFunctions());
-	t("deployedSubObjects", subObjectSources(m_context.subObjectsCreated()));
+	auto const deployedSubObjects = m_context.subObjectsCreated();
 	t("metadataName", yul::Object::metadataName());
 	t("cborMetadata", util::toHex(_cborMetadata));
 
@@ -240,7 +255,26 @@ string IRGenerator::generate(
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().creationCallGraph), std::move(creationFunctionList));
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().deployedCallGraph), std::move(deployedFunctionList));
 
-	return t.render();
+	map<string, vector<shared_ptr<yul::Object>>> subObjects;
+	for (ContractDefinition const* subObject: creationSubObjects)
+		subObjects[IRNames::creationObject(_contract)].emplace_back(_otherYulObjects.at(subObject));
+	for (ContractDefinition const* subObject: deployedSubObjects)
+		subObjects[IRNames::deployedObject(_contract)].emplace_back(_otherYulObjects.at(subObject));
+
+	optional<string> codeWithSubObjects;
+	if (_withSubObjectSources && !subObjects.empty())
+	{
+		Whiskers withSubObjects = t;
+		withSubObjects("subObjects", subObjectSources(creationSubObjects));
+		withSubObjects("deployedSubObjects", subObjectSources(deployedSubObjects));
+		codeWithSubObjects = withSubObjects.render();
+	}
+
+	t("subObjects", "")("deployedSubObjects", "");
+	string code = t.render();
+	if (_withSubObjectSources && !codeWithSubObjects)
+		codeWithSubObjects = code;
+	return {std::move(code), std::move(subObjects), std::move(codeWithSubObjects)};
 }
 
 string IRGenerator::generate(Block const& _block)
@@ -746,7 +780,11 @@ string IRGenerator::generateExternalFunction(ContractDefinition const& _contract
 		unsigned retVars = make_shared<TupleType>(_functionType.returnParameterTypes())->sizeOnStack();
 
 		ABIFunctions abiFunctions(m_evmVersion, m_context.revertStrings(), m_context.functionCollector());
-		t("abiDecode", abiFunctions.tupleDecoder(_functionType.parameterTypes()));
+		t("abiDecode",
+			m_optimiserSettings.specializeStaticTupleDecoding ?
+			abiFunctions.staticTupleDecoder(_functionType.parameterTypes()) :
+			abiFunctions.tupleDecoder(_functionType.parameterTypes())
+		);
 		t("params",  suffixedVariableNameList("param_", 0, paramVars));
 		t("retParams",  suffixedVariableNameList("ret_", 0, retVars));
 
@@ -995,13 +1033,48 @@ string IRGenerator::callValueCheck()
 	return "if callvalue() { " + m_utils.revertReasonIfDebugFunction("Ether sent to non-payable function") + "() }";
 }
 
+string IRGenerator::selectFunction(vector<map<string, string>> const& _cases)
+{
+	// The cases are sorted by selector.
+	if (!CompilerUtils::splitFunctionSelection(_cases.size(), m_optimiserSettings.expectedExecutionsPerDeployment))
+		return Whiskers(R"X(
+			switch selector
+			<#cases>
+			case <functionSelector>
+			{
+				// <functionName>
+				<delegatecallCheck>
+				<externalFunction>()
+			}
+			</cases>
+			default {}
+		)X")
+		("cases", _cases)
+		.render();
+
+	auto pivot = _cases.begin() + static_cast<ptrdiff_t>(_cases.size() / 2);
+	return Whiskers(R"X(
+		switch lt(selector, <pivot>)
+		case 0 {
+			<larger>
+		}
+		default {
+			<smaller>
+		}
+	)X")
+	("pivot", pivot->at("functionSelector"))
+	("larger", selectFunction({pivot, _cases.end()}))
+	("smaller", selectFunction({_cases.begin(), pivot}))
+	.render();
+}
+
 string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 {
 	Whiskers t(R"X(
 		<?+cases>if iszero(lt(calldatasize(), 4))
 		{
 			let selector := <shr224>(calldataload(0))
-			switch selector
+			<?binarySearch><selectFunction><!binarySearch>switch selector
 			<#cases>
 			case <functionSelector>
 			{
@@ -1010,7 +1083,7 @@ string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 				<externalFunction>()
 			}
 			</cases>
-			default {}
+			default {}</binarySearch>
 		}</+cases>
 		<?+receiveEther>if iszero(calldatasize()) { <receiveEther> }</+receiveEther>
 		<fallback>
@@ -1040,7 +1113,10 @@ string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 
 		templ["externalFunction"] = generateExternalFunction(_contract, *type);
 	}
-	t("cases", functions);
+	t("binarySearch", m_optimiserSettings.binarySearchDispatch);
+	if (m_optimiserSettings.binarySearchDispatch)
+		t("selectFunction", selectFunction(functions));
+	t("cases", std::move(functions));
 	FunctionDefinition const* etherReceiver = _contract.receiveFunction();
 	if (etherReceiver)
 	{
@@ -1115,7 +1191,8 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_optimiserSettings,
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_context.functionCollector().sharedFunctions()
 	);
 	newContext.copyFunctionIDsFrom(m_context);
 	m_context = std::move(newContext);
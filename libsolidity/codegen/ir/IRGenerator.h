@@ -32,7 +32,17 @@
 #include <liblangutil/CharStreamProvider.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <map>
+#include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <vector>
+
+namespace solidity::yul
+{
+struct Object;
+}
 
 namespace solidity::frontend
 {
@@ -51,7 +61,8 @@ public:
 		OptimiserSettings _optimiserSettings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<SharedYulFunctions> _sharedFunctions = {}
 	):
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
@@ -63,24 +74,47 @@ public:
 			std::move(_optimiserSettings),
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_soliditySourceProvider
+			_soliditySourceProvider,
+			std::move(_sharedFunctions)
 		),
-		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
+		m_utils(
+			_evmVersion,
+			m_context.revertStrings(),
+			m_context.functionCollector(),
+			m_optimiserSettings.coalescePackedStorageWrites
+		)
 	{}
 
 	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// (or just pretty-printed, depending on the optimizer settings), together with the
+	/// optimized and analyzed object. The unoptimized and the optimized form are left empty
+	/// if @a _printUnoptimized and @a _printOptimized are false, respectively.
+	/// The objects of created contracts are taken from @a _otherYulObjects and shared with the
+	/// returned object instead of being parsed and optimized again. Their code is taken from
+	/// @a _otherYulSources, which is only needed for the unoptimized form.
+	std::tuple<std::string, std::string, std::shared_ptr<yul::Object>> run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object>> const& _otherYulObjects,
+		bool _printUnoptimized = true,
+		bool _printOptimized = true
 	);
 
 private:
-	std::string generate(
+	/// @returns the IR code without the code of created contracts, the objects of the created
+	/// contracts by the name of the object they are sub-objects of and, if @a _withSubObjectSources
+	/// is true, the IR code including the code of created contracts.
+	std::tuple<
+		std::string,
+		std::map<std::string, std::vector<std::shared_ptr<yul::Object>>>,
+		std::optional<std::string>
+	> generate(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object>> const& _otherYulObjects,
+		bool _withSubObjectSources
 	);
 	std::string generate(Block const& _block);
 
@@ -130,6 +164,10 @@ private:
 	std::string callValueCheck();
 
 	std::string dispatchRoutine(ContractDefinition const& _contract);
+	/// @returns code that calls the external function of @a _cases, which are sorted by selector,
+	/// whose selector matches the variable "selector". Uses a binary search if the expected number
+	/// of executions makes it profitable.
+	std::string selectFunction(std::vector<std::map<std::string, std::string>> const& _cases);
 
 	/// @a _useMemoryGuard If true, use a memory guard, allowing the optimiser
 	/// to perform memory optimizations.
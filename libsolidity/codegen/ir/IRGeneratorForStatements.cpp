@@ -963,11 +963,33 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 		{
 			solAssert(functionDef->isImplemented());
 
+			// Nothing the function allocates can be referenced after the call,
+			// so its memory can be reused by resetting the free memory pointer.
+			string freeMemoryPointer;
+			if (m_context.optimiserSettings().reclaimCallMemory && m_context.callMemoryReclaimable(*functionDef))
+			{
+				freeMemoryPointer = m_context.newYulVariable();
+				appendCode() <<
+					"let " <<
+					freeMemoryPointer <<
+					" := mload(" <<
+					to_string(CompilerUtils::freeMemoryPointer) <<
+					")\n";
+			}
+
 			define(_functionCall) <<
 				m_context.enqueueFunctionForCodeGeneration(*functionDef) <<
 				"(" <<
 				joinHumanReadable(args) <<
 				")\n";
+
+			if (!freeMemoryPointer.empty())
+				appendCode() <<
+					"mstore(" <<
+					to_string(CompilerUtils::freeMemoryPointer) <<
+					", " <<
+					freeMemoryPointer <<
+					")\n";
 		}
 		else
 		{
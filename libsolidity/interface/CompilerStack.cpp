@@ -83,10 +83,15 @@
 
 #include <range/v3/view/concat.hpp>
 
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <utility>
 #include <map>
 #include <limits>
 #include <string>
+#include <system_error>
+#include <thread>
 
 using namespace std;
 using namespace solidity;
@@ -98,6 +103,38 @@ using solidity::util::toHex;
 
 static int g_compilerStackCounts = 0;
 
+namespace
+{
+
+/// Runs @a _task for all indices below @a _count, distributed over the available hardware threads.
+/// Falls back to running them on the calling thread if no further threads can be started.
+/// @a _task must not throw.
+void forEachConcurrently(size_t _count, function<void(size_t)> const& _task)
+{
+	atomic<size_t> nextIndex{0};
+	auto worker = [&]() {
+		for (size_t index = nextIndex++; index < _count; index = nextIndex++)
+			_task(index);
+	};
+
+	vector<thread> threads;
+	size_t const threadCount = min<size_t>(_count, thread::hardware_concurrency());
+	try
+	{
+		while (threads.size() + 1 < threadCount)
+			threads.emplace_back(worker);
+	}
+	catch (system_error const&)
+	{
+		// Threads are not available on all platforms, the remaining work is done below.
+	}
+	worker();
+	for (thread& workerThread: threads)
+		workerThread.join();
+}
+
+}
+
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_readFile{std::move(_readFile)},
 	m_errorReporter{m_errorList}
@@ -218,6 +255,20 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setReuseOptimizedIR(bool _reuseOptimizedIR)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set reuseOptimizedIR before parsing.");
+	m_reuseOptimizedIR = _reuseOptimizedIR;
+}
+
+void CompilerStack::setConcurrentParsing(bool _concurrentParsing)
+{
+	if (m_stackState >= ParsedAndImported)
+		solThrow(CompilerError, "Must set concurrent parsing before parsing.");
+	m_concurrentParsing = _concurrentParsing;
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -310,6 +361,8 @@ void CompilerStack::reset(bool _keepSettings)
 		m_importRemapper.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_reuseOptimizedIR = false;
+		m_concurrentParsing = true;
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
@@ -324,6 +377,8 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_sharedYulFunctions.reset();
+	m_yulUtilityCodeCache.reset();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -348,17 +403,37 @@ bool CompilerStack::parse()
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
-
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
+	// The sources are parsed in waves, each consisting of the sources newly imported by the previous one.
+	// The sources of a wave are parsed concurrently if possible, which yields the same result as
+	// parsing all sources sequentially by a single parser.
+	int64_t lastNodeID = 0;
+	size_t waveEnd = 0;
+	bool waveParsed = false;
 	for (size_t i = 0; i < sourcesToParse.size(); ++i)
 	{
+		if (i == waveEnd)
+		{
+			waveEnd = sourcesToParse.size();
+			waveParsed = parseConcurrently(
+				vector<string>(sourcesToParse.begin() + static_cast<ptrdiff_t>(i), sourcesToParse.end()),
+				lastNodeID
+			);
+		}
+
 		string const& path = sourcesToParse[i];
 		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
+		if (!waveParsed)
+		{
+			Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
+			source.ast = parser.parse(*source.charStream);
+			if (source.ast)
+				Parser::shiftNodeIDs(*source.ast, lastNodeID);
+			lastNodeID += parser.lastNodeID();
+		}
 		if (!source.ast)
 			solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
 		else
@@ -401,11 +476,58 @@ bool CompilerStack::parse()
 	return !m_hasError;
 }
 
-void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
+bool CompilerStack::parseConcurrently(vector<string> const& _paths, int64_t& _lastNodeID)
+{
+	if (!m_concurrentParsing || _paths.size() < 2 || thread::hardware_concurrency() < 2)
+		return false;
+
+	struct ParsedSource
+	{
+		CharStream* charStream = nullptr;
+		ASTPointer<SourceUnit> ast;
+		int64_t lastNodeID = 0;
+		bool success = false;
+	};
+	vector<ParsedSource> parsedSources(_paths.size());
+	for (size_t i = 0; i < _paths.size(); ++i)
+		parsedSources[i].charStream = m_sources.at(_paths[i]).charStream.get();
+
+	forEachConcurrently(parsedSources.size(), [&](size_t _index) {
+		ParsedSource& parsedSource = parsedSources[_index];
+		try
+		{
+			ErrorList errors;
+			ErrorReporter errorReporter{errors};
+			Parser parser{errorReporter, m_evmVersion, m_parserErrorRecovery};
+			parsedSource.ast = parser.parse(*parsedSource.charStream);
+			parsedSource.lastNodeID = parser.lastNodeID();
+			// Diagnostics are rare and their order matters, so they are left to the sequential parser.
+			parsedSource.success = parsedSource.ast && errors.empty();
+		}
+		catch (...)
+		{
+			parsedSource.success = false;
+		}
+	});
+
+	for (ParsedSource const& parsedSource: parsedSources)
+		if (!parsedSource.success)
+			return false;
+
+	for (size_t i = 0; i < _paths.size(); ++i)
+	{
+		Parser::shiftNodeIDs(*parsedSources[i].ast, _lastNodeID);
+		_lastNodeID += parsedSources[i].lastNodeID;
+		m_sources[_paths[i]].ast = std::move(parsedSources[i].ast);
+	}
+	return true;
+}
+
+void CompilerStack::importASTs(map<string, Json::Value> _sources)
 {
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must call importASTs only before the SourcesSet state.");
-	m_sourceJsons = _sources;
+	m_sourceJsons = std::move(_sources);
 	map<string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(m_sourceJsons);
 	for (auto& src: reconstructedSources)
 	{
@@ -671,6 +793,8 @@ bool CompilerStack::compile(State _stopAfter)
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	m_sharedYulFunctions = make_shared<SharedYulFunctions>();
+	m_yulUtilityCodeCache = make_shared<YulUtilityCodeCache>(m_evmVersion, m_optimiserSettings);
 
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
@@ -1333,7 +1457,12 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		m_yulUtilityCodeCache
+	);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
@@ -1361,7 +1490,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		solThrow(CompilerError, "Called generateIR with errors.");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	if (!compiledContract.yulIR.empty())
+	if (compiledContract.yulIROptimizedObject)
 		return;
 
 	if (!*_contract.sourceUnit().annotation().useABICoderV2)
@@ -1380,8 +1509,13 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		return;
 
 	map<ContractDefinition const*, string_view const> otherYulSources;
+	map<ContractDefinition const*, shared_ptr<yul::Object>> otherYulObjects;
 	for (auto const& pair: m_contracts)
+	{
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
+		if (pair.second.yulIROptimizedObject)
+			otherYulObjects.emplace(pair.second.contract, pair.second.yulIROptimizedObject);
+	}
 
 	IRGenerator generator(
 		m_evmVersion,
@@ -1390,12 +1524,19 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		m_optimiserSettings,
 		sourceIndices(),
 		m_debugInfoSelection,
-		this
+		this,
+		m_sharedYulFunctions
 	);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(
+	// The unoptimized IR only has to be printed if it is requested, the optimized IR also if it is
+	// re-parsed later on.
+	bool printOptimized = !(m_viaIR && m_reuseOptimizedIR) || m_generateIR || m_generateEwasm;
+	tie(compiledContract.yulIR, compiledContract.yulIROptimized, compiledContract.yulIROptimizedObject) = generator.run(
 		_contract,
 		createCBORMetadata(compiledContract, /* _forIR */ true),
-		otherYulSources
+		otherYulSources,
+		otherYulObjects,
+		m_generateIR,
+		printOptimized
 	);
 }
 
@@ -1409,11 +1550,10 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
+	solAssert(!compiledContract.yulIROptimized.empty() || m_reuseOptimizedIR, "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
 	yul::YulStack stack(
 		m_evmVersion,
 		m_eofVersion,
@@ -1421,7 +1561,11 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		m_optimiserSettings,
 		m_debugInfoSelection
 	);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+	if (m_reuseOptimizedIR)
+		stack.setParsedAndAnalyzed("", compiledContract.yulIROptimizedObject);
+	else
+		// Re-parse the Yul IR in EVM dialect
+		stack.parseAndAnalyze("", compiledContract.yulIROptimized);
 	stack.optimize();
 
 	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
@@ -1573,13 +1717,30 @@ string CompilerStack::createMetadata(Contract const& _contract, bool _forIR) con
 		details["peephole"] = m_optimiserSettings.runPeephole;
 		details["deduplicate"] = m_optimiserSettings.runDeduplicate;
 		details["cse"] = m_optimiserSettings.runCSE;
+		// Only included if enabled to keep the metadata of previous configurations unchanged.
+		if (m_optimiserSettings.runCSEAcrossBlocks)
+			details["cseAcrossBlocks"] = true;
 		details["constantOptimizer"] = m_optimiserSettings.runConstantOptimiser;
+		// Only included if enabled to keep the metadata of previous configurations unchanged.
+		if (m_optimiserSettings.specializeStaticTupleDecoding)
+			details["staticTupleDecoding"] = true;
+		if (m_optimiserSettings.binarySearchDispatch)
+			details["binarySearchDispatch"] = true;
+		if (m_optimiserSettings.coalescePackedStorageWrites)
+			details["packedStorageCoalescing"] = true;
+		if (m_optimiserSettings.reclaimCallMemory)
+			details["callMemoryReclaiming"] = true;
 		details["yul"] = m_optimiserSettings.runYulOptimiser;
 		if (m_optimiserSettings.runYulOptimiser)
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps + ":" + m_optimiserSettings.yulOptimiserCleanupSteps;
+			// Only included if set to keep the metadata of previous configurations unchanged.
+			if (m_optimiserSettings.optimalStackShufflingLimit > 0)
+				details["yulDetails"]["stackShufflingLimit"] = Json::UInt64(m_optimiserSettings.optimalStackShufflingLimit);
+			if (m_optimiserSettings.preferRarelyUsedVariablesForMemory)
+				details["yulDetails"]["rarelyUsedVariablesToMemory"] = true;
 		}
 
 		meta["settings"]["optimizer"]["details"] = std::move(details);
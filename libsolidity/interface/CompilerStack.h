@@ -62,6 +62,11 @@ class CharStream;
 }
 
 
+namespace solidity::yul
+{
+struct Object;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -81,6 +86,8 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class SharedYulFunctions;
+class YulUtilityCodeCache;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -176,6 +183,18 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Hands the optimized Yul object from IR generation directly to EVM code generation
+	/// instead of printing and re-parsing it. Produces the same bytecode, but source
+	/// locations of some IR nodes may differ.
+	/// Must be set before parsing.
+	void setReuseOptimizedIR(bool _reuseOptimizedIR);
+
+	/// Sets whether independent sources may be parsed on separate threads. The threads are
+	/// started with the default stack size of the platform, which can be smaller than the
+	/// one of the calling thread, so deeply nested sources may need this to be turned off.
+	/// Enabled by default. Must be set before parsing.
+	void setConcurrentParsing(bool _concurrentParsing);
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -200,7 +219,8 @@ public:
 	/// Enable EVM Bytecode generation. This is enabled by default.
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
-	/// Enable generation of Yul IR code.
+	/// Enable generation of Yul IR code. Without it, the IR is only printed when it is needed
+	/// for compiling via the IR.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
@@ -231,7 +251,7 @@ public:
 
 	/// Imports given SourceUnits so they can be analyzed. Leads to the same internal state as parse().
 	/// Will throw errors if the import fails
-	void importASTs(std::map<std::string, Json::Value> const& _sources);
+	void importASTs(std::map<std::string, Json::Value> _sources);
 
 	/// Performs the analysis steps (imports, scopesetting, syntaxCheck, referenceResolving,
 	///  typechecking, staticAnalysis) on previously parsed sources.
@@ -276,7 +296,7 @@ public:
 	/// @returns either the contract's name or a mixture of its name and source file, sanitized for filesystem use
 	std::string const filesystemFriendlyName(std::string const& _contractName) const;
 
-	/// @returns the IR representation of a contract.
+	/// @returns the IR representation of a contract. Only available if IR generation is enabled.
 	std::string const& yulIR(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract.
@@ -389,6 +409,9 @@ private:
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Yul IR code.
 		std::string yulIROptimized; ///< Optimized Yul IR code.
+		/// Optimized and analyzed Yul IR object. Shared with the objects of contracts creating this
+		/// one and thus never modified.
+		std::shared_ptr<yul::Object> yulIROptimizedObject;
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -405,6 +428,12 @@ private:
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
+	/// Parses the sources at @a _paths concurrently and numbers their nodes after @a _lastNodeID,
+	/// which is advanced accordingly.
+	/// @returns false, without modifying any state, if any source could not be parsed without
+	/// diagnostics, in which case the sources have to be parsed sequentially.
+	bool parseConcurrently(std::vector<std::string> const& _paths, int64_t& _lastNodeID);
+
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
 	/// @a m_readFile
 	/// @returns the newly loaded sources.
@@ -501,6 +530,8 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	bool m_reuseOptimizedIR = false;
+	bool m_concurrentParsing = true;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
@@ -518,6 +549,10 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Yul utility functions shared between the IR of all contracts of the current compilation.
+	std::shared_ptr<SharedYulFunctions> m_sharedYulFunctions;
+	/// Yul utility code of the legacy code generator shared between all contracts of the current compilation.
+	std::shared_ptr<YulUtilityCodeCache> m_yulUtilityCodeCache;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
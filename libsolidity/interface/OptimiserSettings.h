@@ -61,6 +61,10 @@ struct OptimiserSettings
 
 	static char constexpr DefaultYulOptimiserCleanupSteps[] = "fDnTOc";
 
+	/// Largest accepted value of @a optimalStackShufflingLimit. Slots deeper than the deepest
+	/// SWAP cannot be reached anyway and the search space grows exponentially in the stack size.
+	static size_t constexpr MaxOptimalStackShufflingLimit = 16;
+
 	/// No optimisations at all - not recommended.
 	static OptimiserSettings none()
 	{
@@ -116,11 +120,18 @@ struct OptimiserSettings
 			runPeephole == _other.runPeephole &&
 			runDeduplicate == _other.runDeduplicate &&
 			runCSE == _other.runCSE &&
+			runCSEAcrossBlocks == _other.runCSEAcrossBlocks &&
 			runConstantOptimiser == _other.runConstantOptimiser &&
+			specializeStaticTupleDecoding == _other.specializeStaticTupleDecoding &&
+			binarySearchDispatch == _other.binarySearchDispatch &&
+			coalescePackedStorageWrites == _other.coalescePackedStorageWrites &&
+			reclaimCallMemory == _other.reclaimCallMemory &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			optimalStackShufflingLimit == _other.optimalStackShufflingLimit &&
+			preferRarelyUsedVariablesForMemory == _other.preferRarelyUsedVariablesForMemory;
 	}
 
 	/// Move literals to the right of commutative binary operators during code generation.
@@ -136,11 +147,36 @@ struct OptimiserSettings
 	bool runDeduplicate = false;
 	/// Common subexpression eliminator based on assembly items.
 	bool runCSE = false;
+	/// Let the common subexpression eliminator use the knowledge about the state propagated
+	/// along the control flow graph to the start of each basic block.
+	bool runCSEAcrossBlocks = false;
 	/// Constant optimizer, which tries to find better representations that satisfy the given
 	/// size/cost-trade-off.
 	bool runConstantOptimiser = false;
+	/// Decode the arguments of external functions that only take statically encoded value types
+	/// by loading them from constant offsets after a single size check, instead of using the
+	/// general decoder that calls a decoding function per argument.
+	bool specializeStaticTupleDecoding = false;
+	/// Let the function dispatcher of the IR-based code generator compare the selector against
+	/// pivots where the expected number of executions makes it profitable, like the legacy code
+	/// generator does, instead of always comparing against all selectors in turn.
+	bool binarySearchDispatch = false;
+	/// When copying structs to storage via the IR-based code generator, combine the writes to
+	/// consecutive value type members packed into the same slot into a single sload and sstore.
+	bool coalescePackedStorageWrites = false;
+	/// Let the IR-based code generator reset the free memory pointer after internal function calls
+	/// if nothing allocated during the call can be referenced afterwards.
+	bool reclaimCallMemory = false;
 	/// Perform more efficient stack allocation for variables during code generation from Yul to bytecode.
 	bool optimizeStackAllocation = false;
+	/// Maximal number of stack slots up to which the stack shuffling code of the optimized Yul to bytecode
+	/// transform is found by an exhaustive search for the cheapest sequence of operations instead of heuristically.
+	/// Zero disables the search. At most @a MaxOptimalStackShufflingLimit. Only used if @a optimizeStackAllocation is set.
+	size_t optimalStackShufflingLimit = 0;
+	/// When moving variables to memory to avoid stack too deep errors, prefer variables that are rarely
+	/// accessed, in particular inside loops, and variables that resolve several errors at once,
+	/// instead of the first variables reported for each error.
+	bool preferRarelyUsedVariablesForMemory = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
 	/// Sequence of optimisation steps to be performed by Yul optimiser.
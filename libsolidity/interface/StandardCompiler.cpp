@@ -439,7 +439,7 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static set<string> keys{"parserErrorRecovery", "concurrentParsing", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "reuseOptimizedIR", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -457,7 +457,7 @@ std::optional<Json::Value> checkOptimizerKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkOptimizerDetailsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails"};
+	static set<string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "cseAcrossBlocks", "constantOptimizer", "staticTupleDecoding", "binarySearchDispatch", "packedStorageCoalescing", "callMemoryReclaiming", "yul", "yulDetails"};
 	return checkKeys(_input, keys, "settings.optimizer.details");
 }
 
@@ -611,8 +611,18 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 			return *error;
 		if (auto error = checkOptimizerDetail(details, "cse", settings.runCSE))
 			return *error;
+		if (auto error = checkOptimizerDetail(details, "cseAcrossBlocks", settings.runCSEAcrossBlocks))
+			return *error;
 		if (auto error = checkOptimizerDetail(details, "constantOptimizer", settings.runConstantOptimiser))
 			return *error;
+		if (auto error = checkOptimizerDetail(details, "staticTupleDecoding", settings.specializeStaticTupleDecoding))
+			return *error;
+		if (auto error = checkOptimizerDetail(details, "binarySearchDispatch", settings.binarySearchDispatch))
+			return *error;
+		if (auto error = checkOptimizerDetail(details, "packedStorageCoalescing", settings.coalescePackedStorageWrites))
+			return *error;
+		if (auto error = checkOptimizerDetail(details, "callMemoryReclaiming", settings.reclaimCallMemory))
+			return *error;
 		if (auto error = checkOptimizerDetail(details, "yul", settings.runYulOptimiser))
 			return *error;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
@@ -621,12 +631,25 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 			if (!settings.runYulOptimiser)
 				return formatFatalError(Error::Type::JSONError, "\"Providing yulDetails requires Yul optimizer to be enabled.");
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
+			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps", "stackShufflingLimit", "rarelyUsedVariablesToMemory"}, "settings.optimizer.details.yulDetails"))
 				return *result;
 			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
 				return *error;
 			if (auto error = checkOptimizerDetailSteps(details["yulDetails"], "optimizerSteps", settings.yulOptimiserSteps, settings.yulOptimiserCleanupSteps))
 				return *error;
+			if (auto error = checkOptimizerDetail(details["yulDetails"], "rarelyUsedVariablesToMemory", settings.preferRarelyUsedVariablesForMemory))
+				return *error;
+			if (details["yulDetails"].isMember("stackShufflingLimit"))
+			{
+				Json::Value const& limit = details["yulDetails"]["stackShufflingLimit"];
+				if (!limit.isUInt() || limit.asUInt() > OptimiserSettings::MaxOptimalStackShufflingLimit)
+					return formatFatalError(
+						Error::Type::JSONError,
+						"settings.optimizer.details.yulDetails.stackShufflingLimit must be an unsigned integer not greater than " +
+						to_string(OptimiserSettings::MaxOptimalStackShufflingLimit) + "."
+					);
+				settings.optimalStackShufflingLimit = limit.asUInt();
+			}
 		}
 	}
 	return { std::move(settings) };
@@ -791,6 +814,20 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("reuseOptimizedIR"))
+	{
+		if (!settings["reuseOptimizedIR"].isBool())
+			return formatFatalError(Error::Type::JSONError, "\"settings.reuseOptimizedIR\" must be a Boolean.");
+		ret.reuseOptimizedIR = settings["reuseOptimizedIR"].asBool();
+	}
+
+	if (settings.isMember("concurrentParsing"))
+	{
+		if (!settings["concurrentParsing"].isBool())
+			return formatFatalError(Error::Type::JSONError, "\"settings.concurrentParsing\" must be a Boolean.");
+		ret.concurrentParsing = settings["concurrentParsing"].asBool();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -1113,6 +1150,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setReuseOptimizedIR(_inputsAndSettings.reuseOptimizedIR);
+	compilerStack.setConcurrentParsing(_inputsAndSettings.concurrentParsing);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setParserErrorRecovery(_inputsAndSettings.parserErrorRecovery);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
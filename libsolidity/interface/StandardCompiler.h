@@ -89,6 +89,8 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		bool reuseOptimizedIR = false;
+		bool concurrentParsing = true;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
@@ -23,6 +23,7 @@
 
 #include <libsolidity/parsing/Parser.h>
 
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/interface/Version.h>
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
@@ -35,7 +36,9 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
 #include <cctype>
+#include <mutex>
 #include <vector>
 #include <regex>
 #include <tuple>
@@ -157,6 +160,36 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	}
 }
 
+void Parser::shiftNodeIDs(SourceUnit& _sourceUnit, int64_t _offset)
+{
+	if (_offset == 0)
+		return;
+
+	struct NodeCollector: ASTVisitor
+	{
+		bool visit(VariableDeclaration& _variable) override
+		{
+			// The documentation of variables is not visited, but it is a node with an ID.
+			if (_variable.documentation())
+				nodes.emplace_back(_variable.documentation().get());
+			return visitNode(_variable);
+		}
+		bool visitNode(ASTNode& _node) override
+		{
+			nodes.emplace_back(&_node);
+			return true;
+		}
+		vector<ASTNode*> nodes;
+	};
+	NodeCollector collector;
+	_sourceUnit.accept(collector);
+	// Guard against shifting nodes that are reachable along multiple paths more than once.
+	sort(collector.nodes.begin(), collector.nodes.end());
+	collector.nodes.erase(unique(collector.nodes.begin(), collector.nodes.end()), collector.nodes.end());
+	for (ASTNode* node: collector.nodes)
+		node->m_id += static_cast<size_t>(_offset);
+}
+
 void Parser::parsePragmaVersion(SourceLocation const& _location, vector<Token> const& _tokens, vector<string> const& _literals)
 {
 	SemVerMatchExpressionParser parser(_tokens, _literals);
@@ -1363,6 +1396,12 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 	SourceLocation location = currentLocation();
 
 	expectToken(Token::Assembly);
+	// Sources may be parsed concurrently (see CompilerStack::parseConcurrently), but the Yul parser
+	// is not thread-safe: it interns all identifiers and literals in the global, unsynchronised
+	// YulStringRepository and EVMDialect::strictAssemblyForEVM fills a static cache on first use.
+	// Only inline assembly blocks are serialised, the rest of the sources is still parsed concurrently.
+	static mutex yulMutex;
+	lock_guard<mutex> yulLock(yulMutex);
 	yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
 	if (m_scanner->currentToken() == Token::StringLiteral)
 	{
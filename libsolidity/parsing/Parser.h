@@ -49,6 +49,13 @@ public:
 
 	ASTPointer<SourceUnit> parse(langutil::CharStream& _charStream);
 
+	/// @returns the ID of the node created last by this parser, zero if no node was created yet.
+	int64_t lastNodeID() const { return m_currentNodeID; }
+
+	/// Adds @a _offset to the IDs of all nodes in @a _sourceUnit. This allows sources that were
+	/// parsed by separate parsers to be numbered as if they were parsed by a single one.
+	static void shiftNodeIDs(SourceUnit& _sourceUnit, int64_t _offset);
+
 private:
 	class ASTNodeFactory;
 
@@ -26,15 +26,70 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+struct Whiskers::Template
+{
+	enum class PartKind { Text, Value, List, Condition };
+	struct Part
+	{
+		PartKind kind;
+		/// Literal text or name of the parameter, including the "+" of conditions on values and lists.
+		string text;
+		unique_ptr<Template const> body;
+		unique_ptr<Template const> elseBody;
+	};
+
+	string text;
+	vector<Part> parts;
+	/// The contents of all tags like <name>, <#name>, <?name> and </name>, only for the outermost template.
+	set<string, less<>> tags;
+};
+
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the end of the parameter name starting at @a _pos.
+size_t parameterEnd(string_view _text, size_t _pos)
+{
+	while (_pos < _text.size() && isParameterCharacter(_text[_pos]))
+		++_pos;
+	return _pos;
+}
+
+/// @returns the end of the tag starting at @a _pos, i.e. the position after the closing ">",
+/// if a (possibly empty) @a _prefix is followed by a parameter name and ">", and string_view::npos otherwise.
+size_t tagEnd(string_view _text, size_t _pos, string_view _prefix)
+{
+	if (_text.substr(_pos, 1 + _prefix.size()) != "<" + string(_prefix))
+		return string_view::npos;
+	size_t nameStart = _pos + 1 + _prefix.size();
+	size_t nameEnd = parameterEnd(_text, nameStart);
+	if (nameEnd == nameStart || nameEnd >= _text.size() || _text[nameEnd] != '>')
+		return string_view::npos;
+	return nameEnd + 1;
+}
+
+}
+
 Whiskers::Whiskers(string _template):
-	m_template(std::move(_template))
+	m_template(cachedTemplate(std::move(_template)))
 {
-	checkTemplateValid();
 }
 
 Whiskers& Whiskers::operator()(string _parameter, string _value)
@@ -72,25 +127,19 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
-}
-
-void Whiskers::checkTemplateValid() const
-{
-	regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	smatch match;
-	assertThrow(
-		!regex_search(m_template, match, validTemplate),
-		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
-	);
+	size_t size = m_template->text.size();
+	for (auto const& parameter: m_parameters)
+		size += parameter.second.size();
+	string result;
+	result.reserve(size);
+	render(*m_template, result, m_parameters, nullptr, m_conditions, m_listParameters);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && parameterEnd(_parameter, 0) == _parameter.size(),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -118,92 +167,171 @@ void Whiskers::checkParameterUnknown(string const& _parameter) const
 void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string> const& _prefixes) const
 {
 	for (auto const& prefix: _prefixes)
-	{
-		string tag{"<" + prefix + _parameter + ">"};
 		assertThrow(
-			m_template.find(tag) != string::npos,
+			m_template->tags.count(prefix + _parameter),
 			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
+			"Tag '<" + prefix + _parameter + ">' not found in template:\n" + m_template->text
 		);
-	}
 }
 
-namespace
+shared_ptr<Whiskers::Template const> Whiskers::cachedTemplate(string _template)
 {
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
+	// Rejects tags that are not closed with ">", like "<?name" or "</name ".
+	auto checkTemplateValid = [](string_view _text) {
+		for (size_t pos = _text.find('<'); pos != string_view::npos; pos = _text.find('<', pos + 1))
+		{
+			if (pos + 1 >= _text.size() || string_view("#?!/").find(_text[pos + 1]) == string_view::npos)
+				continue;
+			size_t nameStart = pos + 2;
+			if (nameStart < _text.size() && _text[nameStart] == '+')
+				++nameStart;
+			size_t nameEnd = parameterEnd(_text, nameStart);
+			if (nameEnd == nameStart || (nameEnd < _text.size() && _text[nameEnd] == '>'))
+				continue;
+			assertThrow(
+				false,
+				WhiskersError,
+				"Template contains an invalid/unclosed tag " + string(_text.substr(pos, nameEnd + 1 - pos))
+			);
+		}
+	};
+
+	// Splits the template into parts. At every "<", a value tag, a list or a condition is
+	// recognized, in this order. Lists and conditions end at the first matching closing tag,
+	// nested lists and conditions of the same name are not supported.
+	auto parse = [](string _text, auto const& _parse) -> unique_ptr<Template>
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
+		auto result = make_unique<Template>();
+		result->text = std::move(_text);
+		string_view text = result->text;
+		size_t textStart = 0;
+		auto addPart = [&](size_t _partStart, Template::Part _part) {
+			if (textStart < _partStart)
+				result->parts.push_back({Template::PartKind::Text, string(text.substr(textStart, _partStart - textStart)), {}, {}});
+			result->parts.emplace_back(std::move(_part));
+		};
+		for (size_t pos = text.find('<'); pos != string_view::npos; pos = text.find('<', pos))
+		{
+			if (size_t end = tagEnd(text, pos, ""); end != string_view::npos)
+			{
+				addPart(pos, {Template::PartKind::Value, string(text.substr(pos + 1, end - pos - 2)), {}, {}});
+				textStart = pos = end;
+				continue;
+			}
+			bool isList = tagEnd(text, pos, "#") != string_view::npos;
+			bool isCondition = !isList && (tagEnd(text, pos, "?") != string_view::npos || tagEnd(text, pos, "?+") != string_view::npos);
+			if (isList || isCondition)
+			{
+				size_t bodyStart = text.find('>', pos) + 1;
+				string name(text.substr(pos + 2, bodyStart - pos - 3));
+				string closingTag = "</" + name + ">";
+				size_t bodyEnd = text.find(closingTag, bodyStart);
+				if (bodyEnd != string_view::npos)
+				{
+					Template::Part part{isList ? Template::PartKind::List : Template::PartKind::Condition, name, {}, {}};
+					size_t elseTag = isList ? string_view::npos : text.find("<!" + name + ">", bodyStart);
+					if (elseTag < bodyEnd)
+					{
+						part.body = _parse(string(text.substr(bodyStart, elseTag - bodyStart)), _parse);
+						size_t elseStart = elseTag + name.size() + 3;
+						part.elseBody = _parse(string(text.substr(elseStart, bodyEnd - elseStart)), _parse);
+					}
+					else
+						part.body = _parse(string(text.substr(bodyStart, bodyEnd - bodyStart)), _parse);
+					addPart(pos, std::move(part));
+					textStart = pos = bodyEnd + closingTag.size();
+					continue;
+				}
+			}
+			++pos;
+		}
+		if (textStart < text.size())
+			result->parts.push_back({Template::PartKind::Text, string(text.substr(textStart)), {}, {}});
+		return result;
+	};
+
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<Template const>> cache;
+	lock_guard<mutex> lock(cacheMutex);
+	if (auto it = cache.find(_template); it != cache.end())
+		return it->second;
+
+	checkTemplateValid(_template);
+	shared_ptr<Template> result = parse(_template, parse);
+	for (size_t pos = result->text.find('<'); pos != string::npos; pos = result->text.find('<', pos + 1))
+		for (string_view prefix: {"", "#", "?", "/"})
+			if (size_t end = tagEnd(result->text, pos, prefix); end != string_view::npos)
+				result->tags.emplace(result->text.substr(pos + 1, end - pos - 2));
+	cache.emplace(std::move(_template), result);
 	return result;
 }
-}
 
-string Whiskers::replace(
-	string const& _template,
+void Whiskers::render(
+	Template const& _template,
+	string& _output,
 	StringMap const& _parameters,
+	StringMap const* _listElement,
 	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
+	StringListMap const& _listParameters
 )
 {
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+	auto findParameter = [&](string const& _name) -> string const* {
+		if (_listElement)
+			if (auto it = _listElement->find(_name); it != _listElement->end())
+				return &it->second;
+		if (auto it = _parameters.find(_name); it != _parameters.end())
+			return &it->second;
+		return nullptr;
+	};
+
+	for (Template::Part const& part: _template.parts)
+		switch (part.kind)
 		{
+		case Template::PartKind::Text:
+			_output += part.text;
+			break;
+		case Template::PartKind::Value:
+		{
+			string const* value = findParameter(part.text);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + part.text + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_template.text
 			);
-			return _parameters.at(tagName);
+			_output += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case Template::PartKind::List:
 		{
-			string templ(_match[3]);
+			auto list = _listParameters.find(part.text);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				list != _listParameters.end(),
+				WhiskersError, "List parameter " + part.text + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			// Lists cannot contain lists, so the elements of the list are always the innermost ones.
+			for (auto const& element: list->second)
+			{
+				for (auto const& parameter: element)
+					assertThrow(
+						!_parameters.count(parameter.first) && !(_listElement && _listElement->count(parameter.first)),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(*part.body, _output, _parameters, &element, _conditions, {});
+			}
+			break;
 		}
-		else
+		case Template::PartKind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (part.text[0] == '+')
 			{
-				string tag = conditionName.substr(1);
+				string tag = part.text.substr(1);
 
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
+				if (string const* value = findParameter(tag))
+					conditionValue = !value->empty();
 				else if (_listParameters.count(tag))
 					conditionValue = !_listParameters.at(tag).empty();
 				else
@@ -212,33 +340,14 @@ string Whiskers::replace(
 			else
 			{
 				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
+					_conditions.count(part.text),
+					WhiskersError, "Condition parameter " + part.text + " not set."
 				);
-				conditionValue = _conditions.at(conditionName);
+				conditionValue = _conditions.at(part.text);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+			if (Template const* body = conditionValue ? part.body.get() : part.elseBody.get())
+				render(*body, _output, _parameters, _listElement, _conditions, _listParameters);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
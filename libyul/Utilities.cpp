@@ -27,11 +27,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/FixedHash.h>
 
-#include <boost/algorithm/string.hpp>
-
-#include <algorithm>
-#include <sstream>
-#include <vector>
+#include <string_view>
 
 using namespace std;
 using namespace solidity;
@@ -40,51 +36,61 @@ using namespace solidity::util;
 
 string solidity::yul::reindent(string const& _code)
 {
-	int constexpr indentationWidth = 4;
+	size_t constexpr indentationWidth = 4;
 
-	auto constexpr static countBraces = [](string const& _s) noexcept -> int
+	auto constexpr static isSpace = [](char _ch) noexcept {
+		return _ch == ' ' || _ch == '\t' || _ch == '\n' || _ch == '\v' || _ch == '\f' || _ch == '\r';
+	};
+	auto constexpr static countBraces = [](string_view _line) noexcept -> int
 	{
-		auto const i = _s.find("//");
-		auto const e = i == _s.npos ? end(_s) : next(begin(_s), static_cast<ptrdiff_t>(i));
-		auto const opening = count_if(begin(_s), e, [](auto ch) { return ch == '{' || ch == '('; });
-		auto const closing = count_if(begin(_s), e, [](auto ch) { return ch == '}' || ch == ')'; });
-		return int(opening - closing);
+		int braces = 0;
+		for (char ch: _line.substr(0, _line.find("//")))
+			if (ch == '{' || ch == '(')
+				++braces;
+			else if (ch == '}' || ch == ')')
+				--braces;
+		return braces;
 	};
 
-	vector<string> lines;
-	boost::split(lines, _code, boost::is_any_of("\n"));
-	for (string& line: lines)
-		boost::trim(line);
-
-	// Reduce multiple consecutive empty lines.
-	lines = fold(lines, vector<string>{}, [](auto&& _lines, auto&& _line) {
-		if (!(_line.empty() && !_lines.empty() && _lines.back().empty()))
-			_lines.emplace_back(std::move(_line));
-		return std::move(_lines);
-	});
-
-	stringstream out;
+	string out;
+	out.reserve(_code.size() + _code.size() / 2);
 	int depth = 0;
-
-	for (string const& line: lines)
+	bool previousLineEmpty = false;
+	for (size_t lineStart = 0; lineStart <= _code.size();)
 	{
+		size_t lineEnd = _code.find('\n', lineStart);
+		if (lineEnd == string::npos)
+			lineEnd = _code.size();
+		string_view line{_code.data() + lineStart, lineEnd - lineStart};
+		lineStart = lineEnd + 1;
+
+		while (!line.empty() && isSpace(line.front()))
+			line.remove_prefix(1);
+		while (!line.empty() && isSpace(line.back()))
+			line.remove_suffix(1);
+
+		// Reduce multiple consecutive empty lines.
+		if (line.empty() && previousLineEmpty)
+			continue;
+		previousLineEmpty = line.empty();
+
 		int const diff = countBraces(line);
 		if (diff < 0)
 			depth += diff;
 
 		if (!line.empty())
 		{
-			for (int i = 0; i < depth * indentationWidth; ++i)
-				out << ' ';
-			out << line;
+			if (depth > 0)
+				out.append(static_cast<size_t>(depth) * indentationWidth, ' ');
+			out.append(line);
 		}
-		out << '\n';
+		out += '\n';
 
 		if (diff > 0)
 			depth += diff;
 	}
 
-	return out.str();
+	return out;
 }
 
 u256 solidity::yul::valueOfNumberLiteral(Literal const& _literal)
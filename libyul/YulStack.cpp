@@ -39,6 +39,8 @@
 #include <libevmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
 #include <boost/algorithm/string.hpp>
+
+#include <algorithm>
 #include <optional>
 
 using namespace std;
@@ -64,6 +66,16 @@ Dialect const& languageToDialect(YulStack::Language _language, EVMVersion _versi
 	return Dialect::yulDeprecated();
 }
 
+/// @returns a copy of the tree of objects below @a _object that shares code, data and analysis info with it.
+shared_ptr<Object> copyObjectTree(Object const& _object)
+{
+	auto copy = make_shared<Object>(_object);
+	for (auto& subNode: copy->subObjects)
+		if (auto subObject = dynamic_cast<Object const*>(subNode.get()))
+			subNode = copyObjectTree(*subObject);
+	return copy;
+}
+
 }
 
 
@@ -74,10 +86,15 @@ CharStream const& YulStack::charStream(string const& _sourceName) const
 	return *m_charStream;
 }
 
-bool YulStack::parseAndAnalyze(std::string const& _sourceName, std::string const& _source)
+bool YulStack::parseAndAnalyze(
+	std::string const& _sourceName,
+	std::string const& _source,
+	PreparedSubObjects _preparedSubObjects
+)
 {
 	m_errors.clear();
 	m_analysisSuccessful = false;
+	m_preparedSubObjects.clear();
 	m_charStream = make_unique<CharStream>(_source, _sourceName);
 	shared_ptr<Scanner> scanner = make_shared<Scanner>(*m_charStream);
 	m_parserResult = ObjectParser(m_errorReporter, languageToDialect(m_language, m_evmVersion)).parse(scanner, false);
@@ -86,9 +103,26 @@ bool YulStack::parseAndAnalyze(std::string const& _sourceName, std::string const
 	yulAssert(m_parserResult, "");
 	yulAssert(m_parserResult->code, "");
 
+	insertPreparedSubObjects(*m_parserResult, _preparedSubObjects);
+	yulAssert(_preparedSubObjects.empty(), "Object to insert sub-objects into not found.");
+
 	return analyzeParsed();
 }
 
+void YulStack::setParsedAndAnalyzed(string const& _sourceName, shared_ptr<Object const> const& _object)
+{
+	yulAssert(_object, "");
+	yulAssert(_object->code, "");
+	yulAssert(_object->analysisInfo, "");
+
+	m_errors.clear();
+	m_preparedSubObjects.clear();
+	// The source is not available, but the name is still used for the source mappings.
+	m_charStream = make_unique<CharStream>("", _sourceName);
+	m_parserResult = copyObjectTree(*_object);
+	m_analysisSuccessful = true;
+}
+
 void YulStack::optimize()
 {
 	if (!m_optimiserSettings.runYulOptimiser)
@@ -142,11 +176,45 @@ bool YulStack::analyzeParsed(Object& _object)
 	bool success = analyzer.analyze(*_object.code);
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
-			if (!analyzeParsed(*subObject))
+			if (!m_preparedSubObjects.count(subObject) && !analyzeParsed(*subObject))
 				success = false;
 	return success;
 }
 
+void YulStack::insertPreparedSubObjects(Object& _object, PreparedSubObjects& _preparedSubObjects)
+{
+	if (_preparedSubObjects.empty())
+		return;
+
+	for (auto& subNode: _object.subObjects)
+		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+			insertPreparedSubObjects(*subObject, _preparedSubObjects);
+
+	auto preparedSubObjects = _preparedSubObjects.find(_object.name.str());
+	if (preparedSubObjects == _preparedSubObjects.end())
+		return;
+
+	// In the source, sub-objects precede the data of an object.
+	auto firstData = find_if(_object.subObjects.begin(), _object.subObjects.end(), [](auto const& _subNode) {
+		return dynamic_cast<Data const*>(_subNode.get()) != nullptr;
+	});
+	for (auto const& subObject: preparedSubObjects->second)
+	{
+		yulAssert(subObject && subObject->analysisInfo, "");
+		m_preparedSubObjects.insert(subObject.get());
+	}
+	_object.subObjects.insert(firstData, preparedSubObjects->second.begin(), preparedSubObjects->second.end());
+
+	_object.subIndexByName.clear();
+	for (size_t index = 0; index < _object.subObjects.size(); ++index)
+	{
+		YulString name = _object.subObjects[index]->name;
+		yulAssert(!_object.subIndexByName.count(name), "Duplicate sub-object " + name.str());
+		_object.subIndexByName[name] = index;
+	}
+	_preparedSubObjects.erase(preparedSubObjects);
+}
+
 void YulStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) const
 {
 	EVMDialect const* dialect = nullptr;
@@ -164,7 +232,14 @@ void YulStack::compileEVM(AbstractAssembly& _assembly, bool _optimize) const
 			break;
 	}
 
-	EVMObjectCompiler::compile(*m_parserResult, _assembly, *dialect, _optimize, m_eofVersion);
+	EVMObjectCompiler::compile(
+		*m_parserResult,
+		_assembly,
+		*dialect,
+		_optimize,
+		m_eofVersion,
+		m_optimiserSettings.optimalStackShufflingLimit
+	);
 }
 
 void YulStack::optimize(Object& _object, bool _isCreation)
@@ -172,7 +247,7 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 	yulAssert(_object.code, "");
 	yulAssert(_object.analysisInfo, "");
 	for (auto& subNode: _object.subObjects)
-		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+		if (auto subObject = dynamic_cast<Object*>(subNode.get()); subObject && !m_preparedSubObjects.count(subObject))
 		{
 			bool isCreation = !boost::ends_with(subObject->name.str(), "_deployed");
 			optimize(*subObject, isCreation);
@@ -190,7 +265,8 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		m_optimiserSettings.yulOptimiserSteps,
 		m_optimiserSettings.yulOptimiserCleanupSteps,
 		_isCreation ? nullopt : make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_optimiserSettings.preferRarelyUsedVariablesForMemory
 	);
 }
 
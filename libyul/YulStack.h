@@ -34,8 +34,11 @@
 
 #include <libevmasm/LinkerObject.h>
 
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -97,9 +100,25 @@ public:
 	/// @returns the char stream used during parsing
 	langutil::CharStream const& charStream(std::string const& _sourceName) const override;
 
+	/// Already parsed and analyzed objects, by the name of the object they are sub-objects of.
+	using PreparedSubObjects = std::map<std::string, std::vector<std::shared_ptr<Object>>>;
+
 	/// Runs parsing and analysis steps, returns false if input cannot be assembled.
+	/// The objects in @a _preparedSubObjects are inserted into the parsed objects in front of their
+	/// data, as if they were part of the source. They are shared, i.e. neither analyzed nor optimized
+	/// by this stack, and must not be modified.
+	/// Multiple calls overwrite the previous state.
+	bool parseAndAnalyze(
+		std::string const& _sourceName,
+		std::string const& _source,
+		PreparedSubObjects _preparedSubObjects = {}
+	);
+
+	/// Takes over an object that was already parsed and successfully analyzed for the same
+	/// language and EVM version, e.g. by a different stack, instead of parsing it again.
+	/// The object itself is not modified, all further steps work on a copy that shares its code.
 	/// Multiple calls overwrite the previous state.
-	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
+	void setParsedAndAnalyzed(std::string const& _sourceName, std::shared_ptr<Object const> const& _object);
 
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
@@ -143,6 +162,10 @@ private:
 	bool analyzeParsed();
 	bool analyzeParsed(yul::Object& _object);
 
+	/// Inserts the objects of @a _preparedSubObjects into @a _object and its sub-objects and
+	/// removes them from @a _preparedSubObjects.
+	void insertPreparedSubObjects(yul::Object& _object, PreparedSubObjects& _preparedSubObjects);
+
 	void compileEVM(yul::AbstractAssembly& _assembly, bool _optimize) const;
 
 	void optimize(yul::Object& _object, bool _isCreation);
@@ -157,6 +180,8 @@ private:
 
 	bool m_analysisSuccessful = false;
 	std::shared_ptr<yul::Object> m_parserResult;
+	/// Sub-objects of m_parserResult that were inserted already analyzed and optimized.
+	std::set<yul::Object const*> m_preparedSubObjects;
 	langutil::ErrorList m_errors;
 	langutil::ErrorReporter m_errorReporter;
 
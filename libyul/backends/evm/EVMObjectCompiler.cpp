@@ -40,10 +40,11 @@ void EVMObjectCompiler::compile(
 	AbstractAssembly& _assembly,
 	EVMDialect const& _dialect,
 	bool _optimize,
-	std::optional<uint8_t> _eofVersion
+	std::optional<uint8_t> _eofVersion,
+	size_t _optimalStackShufflingLimit
 )
 {
-	EVMObjectCompiler compiler(_assembly, _dialect, _eofVersion);
+	EVMObjectCompiler compiler(_assembly, _dialect, _eofVersion, _optimalStackShufflingLimit);
 	compiler.run(_object, _optimize);
 }
 
@@ -60,7 +61,14 @@ void EVMObjectCompiler::run(Object& _object, bool _optimize)
 			auto subAssemblyAndID = m_assembly.createSubAssembly(isCreation, subObject->name.str());
 			context.subIDs[subObject->name] = subAssemblyAndID.second;
 			subObject->subId = subAssemblyAndID.second;
-			compile(*subObject, *subAssemblyAndID.first, m_dialect, _optimize, m_eofVersion);
+			compile(
+				*subObject,
+				*subAssemblyAndID.first,
+				m_dialect,
+				_optimize,
+				m_eofVersion,
+				m_optimalStackShufflingLimit
+			);
 		}
 		else
 		{
@@ -87,7 +95,8 @@ void EVMObjectCompiler::run(Object& _object, bool _optimize)
 			*_object.code,
 			m_dialect,
 			context,
-			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName
+			OptimizedEVMCodeTransform::UseNamedLabels::ForFirstFunctionOfEachName,
+			m_optimalStackShufflingLimit
 		);
 		if (!stackErrors.empty())
 		{
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <optional>
+#include <cstddef>
 #include <cstdint>
 
 namespace solidity::yul
@@ -38,11 +39,20 @@ public:
 		AbstractAssembly& _assembly,
 		EVMDialect const& _dialect,
 		bool _optimize,
-		std::optional<uint8_t> _eofVersion
+		std::optional<uint8_t> _eofVersion,
+		size_t _optimalStackShufflingLimit = 0
 	);
 private:
-	EVMObjectCompiler(AbstractAssembly& _assembly, EVMDialect const& _dialect, std::optional<uint8_t> _eofVersion):
-		m_assembly(_assembly), m_dialect(_dialect), m_eofVersion(_eofVersion)
+	EVMObjectCompiler(
+		AbstractAssembly& _assembly,
+		EVMDialect const& _dialect,
+		std::optional<uint8_t> _eofVersion,
+		size_t _optimalStackShufflingLimit
+	):
+		m_assembly(_assembly),
+		m_dialect(_dialect),
+		m_eofVersion(_eofVersion),
+		m_optimalStackShufflingLimit(_optimalStackShufflingLimit)
 	{}
 
 	void run(Object& _object, bool _optimize);
@@ -50,6 +60,7 @@ private:
 	AbstractAssembly& m_assembly;
 	EVMDialect const& m_dialect;
 	std::optional<uint8_t> m_eofVersion;
+	size_t m_optimalStackShufflingLimit = 0;
 };
 
 }
@@ -46,7 +46,8 @@ vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 	Block const& _block,
 	EVMDialect const& _dialect,
 	BuiltinContext& _builtinContext,
-	UseNamedLabels _useNamedLabelsForFunctions
+	UseNamedLabels _useNamedLabelsForFunctions,
+	size_t _optimalStackShufflingLimit
 )
 {
 	std::unique_ptr<CFG> dfg = ControlFlowGraphBuilder::build(_analysisInfo, _dialect, _block);
@@ -56,7 +57,9 @@ vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 		_builtinContext,
 		_useNamedLabelsForFunctions,
 		*dfg,
-		stackLayout
+		stackLayout,
+		_optimalStackShufflingLimit,
+		_dialect.evmVersion()
 	);
 	// Create initial entry layout.
 	optimizedCodeTransform.createStackLayout(debugDataOf(*dfg->entry), stackLayout.blockInfos.at(dfg->entry).entryLayout);
@@ -178,12 +181,16 @@ OptimizedEVMCodeTransform::OptimizedEVMCodeTransform(
 	BuiltinContext& _builtinContext,
 	UseNamedLabels _useNamedLabelsForFunctions,
 	CFG const& _dfg,
-	StackLayout const& _stackLayout
+	StackLayout const& _stackLayout,
+	size_t _optimalStackShufflingLimit,
+	langutil::EVMVersion _evmVersion
 ):
 	m_assembly(_assembly),
 	m_builtinContext(_builtinContext),
 	m_dfg(_dfg),
 	m_stackLayout(_stackLayout),
+	m_optimalStackShufflingLimit(_optimalStackShufflingLimit),
+	m_evmVersion(_evmVersion),
 	m_functionLabels([&](){
 		map<CFG::FunctionInfo const*, AbstractAssembly::LabelID> functionLabels;
 		set<YulString> assignedFunctionNames;
@@ -359,7 +366,8 @@ void OptimizedEVMCodeTransform::createStackLayout(std::shared_ptr<DebugData cons
 		[&]()
 		{
 			m_assembly.appendInstruction(evmasm::Instruction::POP);
-		}
+		},
+		OptimalShufflingSettings{m_optimalStackShufflingLimit, m_evmVersion}
 	);
 	yulAssert(m_assembly.stackHeight() == static_cast<int>(m_stack.size()), "");
 }
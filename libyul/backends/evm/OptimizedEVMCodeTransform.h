@@ -47,13 +47,16 @@ public:
 	/// 2) For none of the functions 3) for the first function of each name.
 	enum class UseNamedLabels { YesAndForceUnique, Never, ForFirstFunctionOfEachName };
 
+	/// @a _optimalStackShufflingLimit is the maximal stack size for which stack shuffling code is
+	/// determined by an exhaustive search rather than heuristically (see ``createStackLayout``).
 	[[nodiscard]] static std::vector<StackTooDeepError> run(
 		AbstractAssembly& _assembly,
 		AsmAnalysisInfo& _analysisInfo,
 		Block const& _block,
 		EVMDialect const& _dialect,
 		BuiltinContext& _builtinContext,
-		UseNamedLabels _useNamedLabelsForFunctions
+		UseNamedLabels _useNamedLabelsForFunctions,
+		size_t _optimalStackShufflingLimit = 0
 	);
 
 	/// Generate code for the function call @a _call. Only public for using with std::visit.
@@ -68,7 +71,9 @@ private:
 		BuiltinContext& _builtinContext,
 		UseNamedLabels _useNamedLabelsForFunctions,
 		CFG const& _dfg,
-		StackLayout const& _stackLayout
+		StackLayout const& _stackLayout,
+		size_t _optimalStackShufflingLimit,
+		langutil::EVMVersion _evmVersion
 	);
 
 	/// Assert that it is valid to transition from @a _currentStack to @a _desiredStack.
@@ -101,6 +106,9 @@ private:
 	BuiltinContext& m_builtinContext;
 	CFG const& m_dfg;
 	StackLayout const& m_stackLayout;
+	size_t const m_optimalStackShufflingLimit = 0;
+	/// EVM version for which the costs of stack shuffling operations are determined.
+	langutil::EVMVersion const m_evmVersion;
 	Stack m_stack;
 	std::map<yul::FunctionCall const*, AbstractAssembly::LabelID> m_returnLabels;
 	std::map<CFG::BasicBlock const*, AbstractAssembly::LabelID> m_blockLabels;
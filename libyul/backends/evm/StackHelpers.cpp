@@ -0,0 +1,191 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/backends/evm/StackHelpers.h>
+
+#include <libevmasm/GasMeter.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Numeric.h>
+
+#include <range/v3/view/reverse.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace std;
+
+namespace
+{
+
+ShuffleCost operationCost(evmasm::Instruction _instruction, size_t _size, langutil::EVMVersion _evmVersion)
+{
+	return {evmasm::GasMeter::runGas(_instruction, _evmVersion), _size};
+}
+
+ShuffleCost pushCost(StackSlot const& _slot, langutil::EVMVersion _evmVersion)
+{
+	// Junk is generated by the code transform using CODESIZE.
+	if (holds_alternative<JunkSlot>(_slot))
+		return operationCost(evmasm::Instruction::CODESIZE, 1, _evmVersion);
+	unsigned bytes = std::visit(util::GenericVisitor{
+		[](LiteralSlot const& _literal) { return std::max(1u, util::numberEncodingSize(_literal.value)); },
+		// Label references are assumed to require two bytes.
+		[](auto const&) { return 2u; }
+	}, _slot);
+	return operationCost(evmasm::pushInstruction(bytes), 1 + bytes, _evmVersion);
+}
+
+}
+
+optional<OptimalShuffle> solidity::yul::findOptimalShuffle(
+	Stack const& _source,
+	Stack const& _target,
+	size_t _maxStackSize,
+	langutil::EVMVersion _evmVersion,
+	size_t _maxStates
+)
+{
+	auto isTarget = [&](Stack const& _stack) {
+		if (_stack.size() != _target.size())
+			return false;
+		for (auto&& [current, target]: ranges::zip_view(_stack, _target))
+			if (!holds_alternative<JunkSlot>(target) && current != target)
+				return false;
+		return true;
+	};
+
+	// The only slots worth pushing or dupping are the ones that are part of the target.
+	vector<StackSlot> candidates;
+	for (auto const& slot: _target)
+		if (!holds_alternative<JunkSlot>(slot) && !util::contains(candidates, slot))
+			candidates.emplace_back(slot);
+
+	struct State
+	{
+		ShuffleCost cost;
+		Stack const* predecessor = nullptr;
+		ShuffleOperation operation;
+		bool settled = false;
+	};
+	map<Stack, State> states;
+	// Ties in cost are broken by discovery order, which keeps the result independent of the memory addresses
+	// that the ordering of variable slots relies on.
+	set<tuple<ShuffleCost, size_t, Stack const*>> queue;
+	size_t discoveryIndex = 0;
+
+	auto relax = [&](Stack _stack, Stack const* _predecessor, ShuffleOperation _operation, ShuffleCost _cost) {
+		auto [it, inserted] = states.try_emplace(std::move(_stack));
+		State& state = it->second;
+		if (!inserted && (state.settled || !(_cost < state.cost)))
+			return;
+		state = State{_cost, _predecessor, std::move(_operation), false};
+		queue.emplace(_cost, discoveryIndex++, &it->first);
+	};
+
+	relax(_source, nullptr, {}, {});
+	while (!queue.empty())
+	{
+		auto [cost, index, stack] = *queue.begin();
+		queue.erase(queue.begin());
+		State& state = states.at(*stack);
+		if (state.settled || state.cost < cost)
+			continue;
+		state.settled = true;
+
+		if (isTarget(*stack))
+		{
+			OptimalShuffle result{{}, cost};
+			for (State const* current = &state; current->predecessor; current = &states.at(*current->predecessor))
+				result.operations.emplace_back(current->operation);
+			std::reverse(result.operations.begin(), result.operations.end());
+			return result;
+		}
+		if (states.size() > _maxStates)
+			return nullopt;
+
+		if (!stack->empty())
+		{
+			Stack next = *stack;
+			next.pop_back();
+			relax(
+				std::move(next),
+				stack,
+				{ShuffleOperation::Kind::Pop, 0, JunkSlot{}},
+				cost + operationCost(evmasm::Instruction::POP, 1, _evmVersion)
+			);
+		}
+		for (size_t depth = 1; depth <= 16 && depth < stack->size(); ++depth)
+		{
+			Stack next = *stack;
+			std::swap(next.at(next.size() - depth - 1), next.back());
+			relax(
+				std::move(next),
+				stack,
+				{ShuffleOperation::Kind::Swap, static_cast<unsigned>(depth), JunkSlot{}},
+				cost + operationCost(evmasm::swapInstruction(static_cast<unsigned>(depth)), 1, _evmVersion)
+			);
+		}
+		if (stack->size() < _maxStackSize)
+			for (StackSlot const& slot: candidates)
+			{
+				ShuffleCost slotCost;
+				// Mirrors the code transform: the topmost copy is dupped, if reachable, otherwise the slot is pushed.
+				if (auto depth = util::findOffset(*stack | ranges::views::reverse, slot); depth && *depth < 16)
+					slotCost = operationCost(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)), 1, _evmVersion);
+				else if (canBeFreelyGenerated(slot))
+					slotCost = pushCost(slot, _evmVersion);
+				else
+					continue;
+				Stack next = *stack;
+				next.emplace_back(slot);
+				relax(std::move(next), stack, {ShuffleOperation::Kind::PushOrDup, 0, slot}, cost + slotCost);
+			}
+	}
+	return nullopt;
+}
+
+ShuffleCost solidity::yul::heuristicShuffleCost(Stack const& _source, Stack const& _target, langutil::EVMVersion _evmVersion)
+{
+	Stack stack = _source;
+	ShuffleCost cost;
+	createStackLayout(
+		stack,
+		_target,
+		[&](unsigned _swapDepth) {
+			cost = cost + (
+				_swapDepth > 16 ?
+				ShuffleCost{1000, 1} :
+				operationCost(evmasm::swapInstruction(_swapDepth), 1, _evmVersion)
+			);
+		},
+		[&](StackSlot const& _slot) {
+			if (auto depth = util::findOffset(stack | ranges::views::reverse, _slot); depth && *depth < 16)
+				cost = cost + operationCost(evmasm::dupInstruction(static_cast<unsigned>(*depth + 1)), 1, _evmVersion);
+			else if (canBeFreelyGenerated(_slot))
+				cost = cost + pushCost(_slot, _evmVersion);
+			else
+				cost = cost + ShuffleCost{1000, 1};
+		},
+		[&]() { cost = cost + operationCost(evmasm::Instruction::POP, 1, _evmVersion); }
+	);
+	return cost;
+}
@@ -21,6 +21,8 @@
 #include <libyul/backends/evm/ControlFlowGraph.h>
 #include <libyul/Exceptions.h>
 
+#include <liblangutil/EVMVersion.h>
+
 #include <libsolutil/Visitor.h>
 
 #include <range/v3/algorithm/all_of.hpp>
@@ -30,6 +32,9 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/take.hpp>
 
+#include <optional>
+#include <tuple>
+
 namespace solidity::yul
 {
 
@@ -54,6 +59,60 @@ inline std::string stackToString(Stack const& _stack)
 	return result;
 }
 
+/// Cost of a sequence of stack shuffling operations.
+struct ShuffleCost
+{
+	/// Runtime gas of the operations.
+	size_t gas = 0;
+	/// Code size of the operations in bytes.
+	size_t size = 0;
+	bool operator<(ShuffleCost const& _rhs) const { return std::tie(gas, size) < std::tie(_rhs.gas, _rhs.size); }
+	ShuffleCost operator+(ShuffleCost const& _rhs) const { return {gas + _rhs.gas, size + _rhs.size}; }
+};
+
+/// A single stack shuffling operation in terms of the callbacks of ``createStackLayout`` below.
+struct ShuffleOperation
+{
+	enum class Kind { Swap, PushOrDup, Pop };
+	Kind kind = Kind::Pop;
+	/// The swap depth, if @a kind is Kind::Swap.
+	unsigned swapDepth = 0;
+	/// The slot to be pushed or dupped, if @a kind is Kind::PushOrDup.
+	StackSlot slot = JunkSlot{};
+};
+
+struct OptimalShuffle
+{
+	std::vector<ShuffleOperation> operations;
+	ShuffleCost cost;
+};
+
+/// Searches for the cheapest sequence of SWAP, DUP, PUSH and POP operations that transforms @a _source to
+/// @a _target, never letting the stack grow beyond @a _maxStackSize slots.
+/// Slots are dupped, if they are reachable, and pushed, if they can be freely generated. Slots that are neither
+/// are never produced.
+/// Operations are priced for @a _evmVersion.
+/// @returns std::nullopt, if no sequence was found before visiting @a _maxStates distinct stack layouts.
+std::optional<OptimalShuffle> findOptimalShuffle(
+	Stack const& _source,
+	Stack const& _target,
+	size_t _maxStackSize,
+	langutil::EVMVersion _evmVersion,
+	size_t _maxStates = 20000
+);
+
+/// @returns the cost for @a _evmVersion of the operations emitted by the heuristic ``Shuffler`` when transforming
+/// @a _source to @a _target.
+ShuffleCost heuristicShuffleCost(Stack const& _source, Stack const& _target, langutil::EVMVersion _evmVersion);
+
+/// Settings of the exhaustive search for stack shuffling code in ``createStackLayout``.
+struct OptimalShufflingSettings
+{
+	/// Maximal number of stack slots up to which the search is performed. Zero disables the search.
+	size_t stackSizeLimit = 0;
+	/// EVM version for which the costs of the operations are determined.
+	langutil::EVMVersion evmVersion;
+};
 
 // Abstraction of stack shuffling operations. Can be defined as actual concept once we switch to C++20.
 // Used as an interface for the stack shuffler below.
@@ -385,9 +444,53 @@ private:
 /// @a _pushOrDup is a function with signature void(StackSlot const&) that is called to push or dup the slot given as
 /// its argument to the stack top.
 /// @a _pop is a function with signature void() that is called when the top most slot is popped.
+/// If neither stack has more than ``_optimalShuffling.stackSizeLimit`` slots, the operations are determined by an
+/// exhaustive search for the cheapest sequence (see ``findOptimalShuffle``), unless the heuristic shuffler is not
+/// more expensive.
 template<typename Swap, typename PushOrDup, typename Pop>
-void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _swap, PushOrDup _pushOrDup, Pop _pop)
+void createStackLayout(
+	Stack& _currentStack,
+	Stack const& _targetStack,
+	Swap _swap,
+	PushOrDup _pushOrDup,
+	Pop _pop,
+	OptimalShufflingSettings const& _optimalShuffling = {}
+)
 {
+	auto replaceJunk = [&]() {
+		yulAssert(_currentStack.size() == _targetStack.size(), "");
+		for (auto&& [current, target]: ranges::zip_view(_currentStack, _targetStack))
+			if (std::holds_alternative<JunkSlot>(target))
+				current = JunkSlot{};
+			else
+				yulAssert(current == target, "");
+	};
+
+	size_t maxSize = std::max(_currentStack.size(), _targetStack.size());
+	if (maxSize <= _optimalShuffling.stackSizeLimit)
+		if (auto optimal = findOptimalShuffle(_currentStack, _targetStack, maxSize + 1, _optimalShuffling.evmVersion))
+			if (optimal->cost < heuristicShuffleCost(_currentStack, _targetStack, _optimalShuffling.evmVersion))
+			{
+				for (ShuffleOperation const& operation: optimal->operations)
+					switch (operation.kind)
+					{
+					case ShuffleOperation::Kind::Swap:
+						_swap(operation.swapDepth);
+						std::swap(_currentStack.at(_currentStack.size() - operation.swapDepth - 1), _currentStack.back());
+						break;
+					case ShuffleOperation::Kind::PushOrDup:
+						_pushOrDup(operation.slot);
+						_currentStack.push_back(operation.slot);
+						break;
+					case ShuffleOperation::Kind::Pop:
+						_pop();
+						_currentStack.pop_back();
+						break;
+					}
+				replaceJunk();
+				return;
+			}
+
 	struct ShuffleOperations
 	{
 		Stack& currentStack;
@@ -456,12 +559,7 @@ void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _sw
 
 	Shuffler<ShuffleOperations>::shuffle(_currentStack, _targetStack, _swap, _pushOrDup, _pop);
 
-	yulAssert(_currentStack.size() == _targetStack.size(), "");
-	for (auto&& [current, target]: ranges::zip_view(_currentStack, _targetStack))
-		if (std::holds_alternative<JunkSlot>(target))
-			current = JunkSlot{};
-		else
-			yulAssert(current == target, "");
+	replaceJunk();
 }
 
 }
@@ -334,7 +334,9 @@ Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::Ba
 void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG::FunctionInfo const* _functionInfo)
 {
 	list<CFG::BasicBlock const*> toVisit{&_entry};
-	set<CFG::BasicBlock const*> visited;
+	unordered_set<CFG::BasicBlock const*> visited;
+	// Blocks whose entry layout has already been derived from their current exit layout at least once.
+	unordered_set<CFG::BasicBlock const*> propagated;
 
 	// TODO: check whether visiting only a subset of these in the outer iteration below is enough.
 	list<pair<CFG::BasicBlock const*, CFG::BasicBlock const*>> backwardsJumps = collectBackwardsJumps(_entry);
@@ -355,8 +357,14 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 			{
 				visited.emplace(block);
 				auto& info = m_layout.blockInfos[block];
-				info.exitLayout = *exitLayout;
-				info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block);
+				// Propagating a layout through a block only depends on its exit layout, so revisits of blocks
+				// whose successors did not change their layouts can reuse the previous result.
+				if (!propagated.count(block) || info.exitLayout != *exitLayout)
+				{
+					info.exitLayout = std::move(*exitLayout);
+					info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block);
+					propagated.emplace(block);
+				}
 
 				for (auto entry: block->entries)
 					toVisit.emplace_back(entry);
@@ -407,7 +415,7 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 
 optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 	CFG::BasicBlock const& _block,
-	set<CFG::BasicBlock const*> const& _visited,
+	unordered_set<CFG::BasicBlock const*> const& _visited,
 	list<CFG::BasicBlock const*>& _toVisit
 ) const
 {
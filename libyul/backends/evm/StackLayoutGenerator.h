@@ -24,6 +24,8 @@
 #include <libyul/backends/evm/ControlFlowGraph.h>
 
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -37,11 +39,11 @@ struct StackLayout
 		/// The resulting stack layout after executing the block.
 		Stack exitLayout;
 	};
-	std::map<CFG::BasicBlock const*, BlockInfo> blockInfos;
+	std::unordered_map<CFG::BasicBlock const*, BlockInfo> blockInfos;
 	/// For each operation the complete stack layout that:
 	/// - has the slots required for the operation at the stack top.
 	/// - will have the operation result in a layout that makes it easy to achieve the next desired layout.
-	std::map<CFG::Operation const*, Stack> operationEntryLayout;
+	std::unordered_map<CFG::Operation const*, Stack> operationEntryLayout;
 };
 
 class StackLayoutGenerator
@@ -85,7 +87,7 @@ private:
 	/// If not, adds the dependencies to @a _dependencyList and @returns std::nullopt.
 	std::optional<Stack> getExitLayoutOrStageDependencies(
 		CFG::BasicBlock const& _block,
-		std::set<CFG::BasicBlock const*> const& _visited,
+		std::unordered_set<CFG::BasicBlock const*> const& _visited,
 		std::list<CFG::BasicBlock const*>& _dependencyList
 	) const;
 
@@ -16,6 +16,7 @@
 */
 
 #include <libyul/optimiser/StackLimitEvader.h>
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/FunctionCallFinder.h>
 #include <libyul/optimiser/NameDispenser.h>
@@ -36,6 +37,8 @@
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/take.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -109,6 +112,40 @@ struct MemoryOffsetAllocator
 	map<YulString, uint64_t> slotsRequiredForFunction{};
 };
 
+/**
+ * Counts the references to each variable, weighting references inside for-loops by their nesting depth.
+ * Used as an estimate of the cost of moving a variable to memory.
+ */
+class WeightedReferenceCounter: public ASTWalker
+{
+public:
+	static map<YulString, uint64_t> run(Block const& _block)
+	{
+		WeightedReferenceCounter counter;
+		counter(_block);
+		return std::move(counter.m_weightedReferences);
+	}
+
+	using ASTWalker::operator();
+	void operator()(Identifier const& _identifier) override
+	{
+		m_weightedReferences[_identifier.name] += m_weight;
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		uint64_t outerWeight = m_weight;
+		// Cap the weight to avoid overflows for deeply nested loops.
+		if (m_weight < 1000000)
+			m_weight *= 10;
+		ASTWalker::operator()(_forLoop);
+		m_weight = outerWeight;
+	}
+
+private:
+	uint64_t m_weight = 1;
+	map<YulString, uint64_t> m_weightedReferences;
+};
+
 u256 literalArgumentValue(FunctionCall const& _call)
 {
 	yulAssert(_call.arguments.size() == 1, "");
@@ -120,7 +157,8 @@ u256 literalArgumentValue(FunctionCall const& _call)
 
 void StackLimitEvader::run(
 	OptimiserStepContext& _context,
-	Object& _object
+	Object& _object,
+	bool _preferRarelyUsedVariables
 )
 {
 	auto const* evmDialect = dynamic_cast<EVMDialect const*>(&_context.dialect);
@@ -132,7 +170,7 @@ void StackLimitEvader::run(
 	{
 		yul::AsmAnalysisInfo analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(*evmDialect, _object);
 		unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, *evmDialect, *_object.code);
-		run(_context, _object, StackLayoutGenerator::reportStackTooDeep(*cfg));
+		run(_context, _object, StackLayoutGenerator::reportStackTooDeep(*cfg), _preferRarelyUsedVariables);
 	}
 	else
 		run(_context, _object, CompilabilityChecker{
@@ -146,14 +184,48 @@ void StackLimitEvader::run(
 void StackLimitEvader::run(
 	OptimiserStepContext& _context,
 	Object& _object,
-	map<YulString, vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+	map<YulString, vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors,
+	bool _preferRarelyUsedVariables
 )
 {
+	yulAssert(_object.code, "");
 	map<YulString, set<YulString>> unreachableVariables;
+	if (!_preferRarelyUsedVariables)
+	{
+		for (auto&& [function, stackTooDeepErrors]: _stackTooDeepErrors)
+			for (auto const& stackTooDeepError: stackTooDeepErrors)
+				unreachableVariables[function] += stackTooDeepError.variableChoices | ranges::views::take(stackTooDeepError.deficit) | ranges::to<set<YulString>>;
+		run(_context, _object, unreachableVariables);
+		return;
+	}
+
+	map<YulString, uint64_t> weightedReferences = WeightedReferenceCounter::run(*_object.code);
 	for (auto&& [function, stackTooDeepErrors]: _stackTooDeepErrors)
-		// TODO: choose wisely.
+	{
+		set<YulString>& chosenVariables = unreachableVariables[function];
 		for (auto const& stackTooDeepError: stackTooDeepErrors)
-			unreachableVariables[function] += stackTooDeepError.variableChoices | ranges::views::take(stackTooDeepError.deficit) | ranges::to<set<YulString>>;
+		{
+			// Variables already moved to memory for another error in the same function count towards the deficit.
+			size_t remainingDeficit = stackTooDeepError.deficit;
+			vector<YulString> candidates;
+			for (YulString variable: stackTooDeepError.variableChoices)
+				if (chosenVariables.count(variable))
+				{
+					if (remainingDeficit > 0)
+						--remainingDeficit;
+				}
+				else
+					candidates.emplace_back(variable);
+			// Prefer the variables that are least frequently accessed, in particular inside loops.
+			// Ties keep the order of the choices, which lists the deepest variables first.
+			stable_sort(candidates.begin(), candidates.end(), [&](YulString _lhs, YulString _rhs) {
+				return
+					util::valueOrDefault(weightedReferences, _lhs, uint64_t(0)) <
+					util::valueOrDefault(weightedReferences, _rhs, uint64_t(0));
+			});
+			chosenVariables += candidates | ranges::views::take(remainingDeficit) | ranges::to<set<YulString>>;
+		}
+	}
 	run(_context, _object, unreachableVariables);
 }
 
@@ -63,6 +63,9 @@ public:
 		std::map<YulString, std::set<YulString>> const& _unreachableVariables
 	);
 	/// @a _stackTooDeepErrors can be determined by the StackLayoutGenerator.
+	/// By default, the first variable choices of each error are moved to memory. If @a _preferRarelyUsedVariables
+	/// is set, variables already chosen for another error count towards the deficit and the remaining
+	/// variables are chosen by the fewest references, weighting references inside loops higher.
 	/// Can only be run on the EVM dialect with objects.
 	/// Abort and do nothing, if no ``memoryguard`` call or several ``memoryguard`` calls
 	/// with non-matching arguments are found, or if any of the @a _stackTooDeepErrors
@@ -70,16 +73,19 @@ public:
 	static void run(
 		OptimiserStepContext& _context,
 		Object& _object,
-		std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+		std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors,
+		bool _preferRarelyUsedVariables = false
 	);
 	/// Determines stack too deep errors using the appropriate code generation backend.
+	/// @a _preferRarelyUsedVariables is used as above, if the errors are reported by the StackLayoutGenerator.
 	/// Can only be run on the EVM dialect with objects.
 	/// Abort and do nothing, if no ``memoryguard`` call or several ``memoryguard`` calls
 	/// with non-matching arguments are found, or if any of the unreachable variables
 	/// are contained in a recursive function.
 	static void run(
 		OptimiserStepContext& _context,
-		Object& _object
+		Object& _object,
+		bool _preferRarelyUsedVariables = false
 	);
 };
 
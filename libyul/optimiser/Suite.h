@@ -62,6 +62,9 @@ public:
 	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// @a _preferRarelyUsedVariablesForMemory is passed on to the StackLimitEvader.
+	/// The code and analysis info of @a _object are replaced, not modified, so they can be shared
+	/// with other objects.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
@@ -70,7 +73,8 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		bool _preferRarelyUsedVariablesForMemory = false
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
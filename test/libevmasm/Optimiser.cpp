@@ -975,6 +975,43 @@ BOOST_AUTO_TEST_CASE(block_deduplicator_loops)
 	BOOST_CHECK_EQUAL(pushTags.size(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(block_deduplicator_verbatim)
+{
+	AssemblyItems blocks{
+		AssemblyItem(Tag, 1),
+		AssemblyItem(bytes{0x01}, 0, 0),
+		Instruction::JUMP,
+		AssemblyItem(Tag, 2),
+		AssemblyItem(bytes{0x02}, 0, 0),
+		Instruction::JUMP,
+		AssemblyItem(Tag, 3),
+		u256(0),
+		Instruction::DUP1,
+		Instruction::REVERT,
+		AssemblyItem(Tag, 4),
+		u256(0),
+		Instruction::DUP1,
+		Instruction::REVERT
+	};
+
+	AssemblyItems input = AssemblyItems{
+		AssemblyItem(PushTag, 2),
+		AssemblyItem(PushTag, 1),
+		AssemblyItem(PushTag, 4),
+		AssemblyItem(PushTag, 3),
+	} + blocks;
+	// The blocks with different verbatim bytecode are kept, only the equal revert blocks are merged.
+	AssemblyItems output = AssemblyItems{
+		AssemblyItem(PushTag, 2),
+		AssemblyItem(PushTag, 1),
+		AssemblyItem(PushTag, 3),
+		AssemblyItem(PushTag, 3),
+	} + blocks;
+	BlockDeduplicator deduplicator(input);
+	BOOST_CHECK(deduplicator.deduplicate());
+	BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(), output.begin(), output.end());
+}
+
 BOOST_AUTO_TEST_CASE(clear_unreachable_code)
 {
 	AssemblyItems items{
@@ -1309,6 +1346,93 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(cse_across_blocks)
+{
+	auto countSLoads = [](bool _acrossBlocks) {
+		Assembly::OptimiserSettings settings;
+		settings.runCSE = true;
+		settings.runCSEAcrossBlocks = _acrossBlocks;
+		settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+		settings.expectedExecutionsPerDeployment = OptimiserSettings{}.expectedExecutionsPerDeployment;
+
+		Assembly assembly{settings.evmVersion, false, {}};
+		auto tag = assembly.newTag();
+		assembly.append(u256(1));
+		assembly.append(Instruction::SLOAD);
+		assembly.append(tag.pushTag());
+		assembly.append(Instruction::JUMP);
+		assembly.append(tag);
+		// The storage slot is known to be on the stack here, since the block is only reached via the jump above.
+		assembly.append(u256(1));
+		assembly.append(Instruction::SLOAD);
+		assembly.append(Instruction::ADD);
+		assembly.append(u256(0));
+		assembly.append(Instruction::SSTORE);
+		assembly.append(Instruction::STOP);
+
+		assembly.optimise(settings);
+		return count(assembly.items().begin(), assembly.items().end(), AssemblyItem{Instruction::SLOAD});
+	};
+	BOOST_CHECK_EQUAL(countSLoads(false), 2);
+	BOOST_CHECK_EQUAL(countSLoads(true), 1);
+}
+
+BOOST_AUTO_TEST_CASE(cse_across_blocks_unreferenced_block)
+{
+	AssemblyItems items{
+		u256(1),
+		Instruction::SLOAD,
+		AssemblyItem(PushTag, 1),
+		Instruction::JUMP,
+		// Not referenced anywhere and not reachable by falling through.
+		AssemblyItem(Tag, 2),
+		u256(2),
+		u256(2),
+		Instruction::SSTORE,
+		Instruction::STOP,
+		AssemblyItem(Tag, 1),
+		u256(1),
+		Instruction::SLOAD,
+		Instruction::ADD,
+		u256(0),
+		Instruction::SSTORE,
+		Instruction::STOP
+	};
+	map<unsigned, KnownStatePointer> startStates = ControlFlowGraph{items}.blockStartStates();
+	BOOST_CHECK(startStates.count(0));
+	BOOST_CHECK(!startStates.count(5));
+	BOOST_CHECK(startStates.count(10));
+
+	Assembly::OptimiserSettings settings;
+	settings.runCSE = true;
+	settings.runCSEAcrossBlocks = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	settings.expectedExecutionsPerDeployment = OptimiserSettings{}.expectedExecutionsPerDeployment;
+
+	Assembly assembly{settings.evmVersion, false, {}};
+	auto usedTag = assembly.newTag();
+	auto unusedTag = assembly.newTag();
+	assembly.append(u256(1));
+	assembly.append(Instruction::SLOAD);
+	assembly.append(usedTag.pushTag());
+	assembly.append(Instruction::JUMP);
+	assembly.append(unusedTag);
+	assembly.append(u256(2));
+	assembly.append(u256(2));
+	assembly.append(Instruction::SSTORE);
+	assembly.append(Instruction::STOP);
+	assembly.append(usedTag);
+	assembly.append(u256(1));
+	assembly.append(Instruction::SLOAD);
+	assembly.append(Instruction::ADD);
+	assembly.append(u256(0));
+	assembly.append(Instruction::SSTORE);
+	assembly.append(Instruction::STOP);
+	assembly.optimise(settings);
+	// The second load of slot 1 is still removed.
+	BOOST_CHECK_EQUAL(count(assembly.items().begin(), assembly.items().end(), AssemblyItem{Instruction::SLOAD}), 1);
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
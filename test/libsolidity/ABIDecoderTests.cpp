@@ -427,6 +427,33 @@ BOOST_AUTO_TEST_CASE(complex_struct)
 	)
 }
 
+BOOST_AUTO_TEST_CASE(static_tuple_decoding)
+{
+	string sourceCode = R"(
+		contract C {
+			enum E { A, B }
+			function f(uint a, uint16 b, bool c, E d, bytes3 e) public pure returns (uint, uint16, bool, E, bytes3) {
+				return (a, b, c, d, e);
+			}
+			function g(uint a, uint[] memory b) public pure returns (uint) { return a + b.length; }
+		}
+	)";
+	m_optimiserSettings.specializeStaticTupleDecoding = true;
+	NEW_ENCODER(
+		compileAndRun(sourceCode);
+		string sig = "f(uint256,uint16,bool,uint8,bytes3)";
+		ABI_CHECK(callContractFunction(sig, 1, 2, true, 1, string("abc")), encodeArgs(1, 2, true, 1, string("abc")));
+		ABI_CHECK(callContractFunctionNoEncoding(sig, bytes(160, 0)), encodeArgs(0, 0, false, 0, 0));
+		ABI_CHECK(callContractFunctionNoEncoding(sig, bytes(159, 0)), encodeArgs());
+		// dirty values
+		ABI_CHECK(callContractFunction(sig, 1, 0x10002, true, 1, string("abc")), encodeArgs());
+		ABI_CHECK(callContractFunction(sig, 1, 2, 2, 1, string("abc")), encodeArgs());
+		ABI_CHECK(callContractFunction(sig, 1, 2, true, 2, string("abc")), encodeArgs());
+		// tuples that are not fully static use the general decoder
+		ABI_CHECK(callContractFunction("g(uint256,uint256[])", 1, 0x40, 2, 5, 6), encodeArgs(3));
+	)
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
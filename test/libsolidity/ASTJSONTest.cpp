@@ -251,6 +251,23 @@ bool ASTJSONTest::runTest(
 		ostringstream result;
 		ASTJsonExporter(_compiler.state(), _sourceIndices).print(result, _compiler.ast(m_sources[i].first), JsonFormat{ JsonFormat::Pretty });
 		_variant.result += result.str();
+
+		// The compact output is streamed and has to match the compact print of the full JSON value.
+		ostringstream compactResult;
+		ASTJsonExporter(_compiler.state(), _sourceIndices).print(compactResult, _compiler.ast(m_sources[i].first), JsonFormat{ JsonFormat::Compact });
+		string compactExpectation = jsonCompactPrint(
+			ASTJsonExporter(_compiler.state(), _sourceIndices).toJson(_compiler.ast(m_sources[i].first))
+		);
+		if (compactResult.str() != compactExpectation)
+		{
+			AnsiColorized(_stream, _formatted, {BOLD, RED}) <<
+				_linePrefix <<
+				"Streamed compact JSON differs from the compact print of the JSON value of " <<
+				m_sources[i].first <<
+				"." <<
+				endl;
+			return false;
+		}
 		if (i != m_sources.size() - 1)
 			_variant.result += ",";
 		_variant.result += "\n";
@@ -25,11 +25,14 @@
 #include <test/Common.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/ImportRemapper.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <limits>
+#include <set>
 #include <string>
 
 using namespace std;
@@ -113,6 +116,50 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(node_ids_follow_source_order)
+{
+	// Sources may be parsed concurrently, but the node IDs have to be the same as if they were
+	// parsed one after the other.
+	CompilerStack c;
+	c.setSources({
+		{"a", "import \"c\"; contract A is C { /// Comment on a. \n uint public a; function f() public pure { assembly { let x := 1 } } }"},
+		{"b", "import \"a\"; contract B is A { /// Comment on x. \n uint public x; }"},
+		{"c", "contract C { function g() public pure returns (uint) { return 1 + 2; } }"},
+		{"d", "import \"b\"; contract D is B { function h() public pure { assembly { let y := 2 } } }"}
+	});
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	BOOST_REQUIRE(c.parse());
+
+	set<int64_t> allIDs;
+	size_t nodeCount = 0;
+	int64_t previousMaxID = 0;
+	for (string const& name: {"a", "b", "c", "d"})
+	{
+		int64_t minID = numeric_limits<int64_t>::max();
+		int64_t maxID = 0;
+		auto record = [&](ASTNode const& _node) {
+			minID = min(minID, _node.id());
+			maxID = max(maxID, _node.id());
+			allIDs.insert(_node.id());
+			++nodeCount;
+		};
+		SimpleASTVisitor visitor{[&](ASTNode const& _node) {
+			record(_node);
+			// The documentation of variables is not visited, but it has an ID as well.
+			if (auto const* variable = dynamic_cast<VariableDeclaration const*>(&_node))
+				if (variable->documentation())
+					record(*variable->documentation());
+			return true;
+		}, {}};
+		c.ast(name).accept(visitor);
+		BOOST_CHECK_GT(minID, previousMaxID);
+		// The source unit is created last.
+		BOOST_CHECK_EQUAL(maxID, c.ast(name).id());
+		previousMaxID = maxID;
+	}
+	BOOST_CHECK_EQUAL(allIDs.size(), nodeCount);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -42,6 +42,7 @@ TestCase::TestResult MemoryGuardTest::run(ostream& _stream, string const& _lineP
 	compiler().reset();
 	compiler().setSources(StringMap{{"", m_source}});
 	compiler().setViaIR(true);
+	compiler().enableIRGeneration();
 	compiler().setOptimiserSettings(OptimiserSettings::none());
 	if (!compiler().compile())
 		return TestResult::FatalError;
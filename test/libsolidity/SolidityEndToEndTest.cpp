@@ -3901,6 +3901,157 @@ BOOST_AUTO_TEST_CASE(strip_reason_strings)
 	)
 }
 
+BOOST_AUTO_TEST_CASE(binary_search_dispatch)
+{
+	char const* sourceCode = R"(
+		contract C {
+			function f0() public pure returns (uint) { return 0; }
+			function f1() public pure returns (uint) { return 1; }
+			function f2() public pure returns (uint) { return 2; }
+			function f3() public pure returns (uint) { return 3; }
+			function f4() public pure returns (uint) { return 4; }
+			function f5() public pure returns (uint) { return 5; }
+			function f6() public pure returns (uint) { return 6; }
+			function f7() public pure returns (uint) { return 7; }
+			function f8() public pure returns (uint) { return 8; }
+			function f9() public pure returns (uint) { return 9; }
+			function f10() public pure returns (uint) { return 10; }
+			function f11() public pure returns (uint) { return 11; }
+		}
+	)";
+	m_optimiserSettings.binarySearchDispatch = true;
+	m_optimiserSettings.expectedExecutionsPerDeployment = 10000;
+	ALSO_VIA_YUL(
+		DISABLE_EWASM_TESTRUN()
+		compileAndRun(sourceCode, 0, "C");
+		ABI_CHECK(callContractFunction("f0()"), encodeArgs(0));
+		ABI_CHECK(callContractFunction("f1()"), encodeArgs(1));
+		ABI_CHECK(callContractFunction("f2()"), encodeArgs(2));
+		ABI_CHECK(callContractFunction("f3()"), encodeArgs(3));
+		ABI_CHECK(callContractFunction("f4()"), encodeArgs(4));
+		ABI_CHECK(callContractFunction("f5()"), encodeArgs(5));
+		ABI_CHECK(callContractFunction("f6()"), encodeArgs(6));
+		ABI_CHECK(callContractFunction("f7()"), encodeArgs(7));
+		ABI_CHECK(callContractFunction("f8()"), encodeArgs(8));
+		ABI_CHECK(callContractFunction("f9()"), encodeArgs(9));
+		ABI_CHECK(callContractFunction("f10()"), encodeArgs(10));
+		ABI_CHECK(callContractFunction("f11()"), encodeArgs(11));
+		ABI_CHECK(callContractFunction("g()"), encodeArgs());
+		if (m_compileViaYul)
+		{
+			// The selector comparisons are only split if the setting is enabled.
+			BOOST_CHECK(m_compiler.yulIR("C").find("switch lt(selector, ") != string::npos);
+			m_optimiserSettings.binarySearchDispatch = false;
+			compileAndRun(sourceCode, 0, "C");
+			BOOST_CHECK(m_compiler.yulIR("C").find("switch lt(selector, ") == string::npos);
+			m_optimiserSettings.binarySearchDispatch = true;
+		}
+	)
+}
+
+BOOST_AUTO_TEST_CASE(packed_storage_coalescing)
+{
+	char const* sourceCode = R"(
+		contract C {
+			struct S {
+				uint8 a;
+				uint16 b;
+				address c;
+				uint256 x;
+				uint128 p;
+				uint128 q;
+				bool d;
+				bytes4 e;
+			}
+			S s;
+			S s2;
+			function fromMemory(uint8 a, uint16 b, address c) public returns (uint8, uint16, address, uint128, uint128, bool, bytes4) {
+				S memory m = S(a, b, c, 7, 8, 9, true, 0x01020304);
+				s = m;
+				return (s.a, s.b, s.c, s.p, s.q, s.d, s.e);
+			}
+			function fromCalldata(S calldata _s) public returns (uint8, uint16, address, uint128, uint128, bool, bytes4) {
+				s = _s;
+				return (s.a, s.b, s.c, s.p, s.q, s.d, s.e);
+			}
+			function fromStorage() public returns (uint8, uint16, address, uint128, bool, bytes4) {
+				s2.a = 3;
+				s2.e = 0x05060708;
+				s = s2;
+				return (s.a, s.b, s.c, s.q, s.d, s.e);
+			}
+		}
+	)";
+	m_optimiserSettings.coalescePackedStorageWrites = true;
+	ALSO_VIA_YUL(
+		DISABLE_EWASM_TESTRUN()
+		compileAndRun(sourceCode, 0, "C");
+		ABI_CHECK(
+			callContractFunction("fromMemory(uint8,uint16,address)", 1, 2, 3),
+			encodeArgs(1, 2, 3, 8, 9, true, "\x01\x02\x03\x04")
+		);
+		ABI_CHECK(
+			callContractFunction(
+				"fromCalldata((uint8,uint16,address,uint256,uint128,uint128,bool,bytes4))",
+				4, 5, 6, 10, 11, 12, false, "\x0a\x0b\x0c\x0d"
+			),
+			encodeArgs(4, 5, 6, 11, 12, false, "\x0a\x0b\x0c\x0d")
+		);
+		ABI_CHECK(callContractFunction("fromStorage()"), encodeArgs(3, 0, 0, 0, false, "\x05\x06\x07\x08"));
+		if (m_compileViaYul)
+		{
+			// The coalescing copy functions are only used if the setting is enabled.
+			BOOST_CHECK(m_compiler.yulIR("C").find("_coalesced") != string::npos);
+			m_optimiserSettings.coalescePackedStorageWrites = false;
+			compileAndRun(sourceCode, 0, "C");
+			BOOST_CHECK(m_compiler.yulIR("C").find("_coalesced") == string::npos);
+			m_optimiserSettings.coalescePackedStorageWrites = true;
+		}
+	)
+}
+
+BOOST_AUTO_TEST_CASE(call_memory_reclaiming)
+{
+	char const* sourceCode = R"(
+		contract C {
+			function sum(uint n) internal pure returns (uint s) {
+				uint[] memory a = new uint[](n);
+				for (uint i = 0; i < n; ++i)
+					a[i] = i;
+				for (uint i = 0; i < n; ++i)
+					s += a[i];
+			}
+			function numbers(uint n) internal pure returns (uint[] memory a) {
+				a = new uint[](n);
+				for (uint i = 0; i < n; ++i)
+					a[i] = i;
+			}
+			function f() public pure returns (uint s, bool reclaimed) {
+				uint freeMemoryBefore;
+				assembly ("memory-safe") { freeMemoryBefore := mload(0x40) }
+				for (uint i = 1; i <= 10; ++i)
+					s += sum(i);
+				uint freeMemoryAfter;
+				assembly ("memory-safe") { freeMemoryAfter := mload(0x40) }
+				reclaimed = freeMemoryBefore == freeMemoryAfter;
+			}
+			function g() public pure returns (uint) {
+				uint[] memory a = numbers(3);
+				uint[] memory b = numbers(4);
+				return a.length * 10 + b.length + a[2] * 100 + b[3] * 1000;
+			}
+		}
+	)";
+	m_optimiserSettings.reclaimCallMemory = true;
+	ALSO_VIA_YUL(
+		DISABLE_EWASM_TESTRUN()
+		compileAndRun(sourceCode, 0, "C");
+		// Only the IR-based code generator reclaims memory.
+		ABI_CHECK(callContractFunction("f()"), encodeArgs(165, m_compileViaYul));
+		ABI_CHECK(callContractFunction("g()"), encodeArgs(3234));
+	)
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -25,6 +25,7 @@
 #include <test/Common.h>
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/TypeProvider.h>
 
 #include <libsolutil/Keccak256.h>
 
@@ -483,6 +484,44 @@ BOOST_AUTO_TEST_CASE(address_staticcall_full_return_type)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(members_shared_between_scopes)
+{
+	char const* text = R"(
+		library L { function ext(C) internal pure {} }
+		contract C {
+			function f() public {}
+			function f(uint) public {}
+			function g() public {}
+		}
+		contract D { using L for C; }
+		contract E {}
+	)";
+	SourceUnit const* sourceUnit = parseAndAnalyse(text);
+	ContractDefinition const* c = retrieveContractByName(*sourceUnit, "C");
+	ContractDefinition const* d = retrieveContractByName(*sourceUnit, "D");
+	ContractDefinition const* e = retrieveContractByName(*sourceUnit, "E");
+	BOOST_REQUIRE(c && d && e);
+	Type const* contractType = TypeProvider::contract(*c);
+
+	// The members of a contract type do not depend on the scope, so scopes without attached
+	// functions share one member list.
+	MemberList const& withoutScope = contractType->members(nullptr);
+	MemberList const& inE = contractType->members(e);
+	BOOST_CHECK_EQUAL(&inE, &withoutScope);
+	BOOST_CHECK_EQUAL(withoutScope.membersByName("f").size(), 2);
+	BOOST_CHECK(withoutScope.memberType("g") != nullptr);
+	BOOST_CHECK(withoutScope.membersByName("ext").empty());
+
+	MemberList const& inD = contractType->members(d);
+	BOOST_CHECK(&inD != &withoutScope);
+	BOOST_CHECK_EQUAL(inD.membersByName("f").size(), 2);
+	BOOST_CHECK(inD.memberType("g") != nullptr);
+	BOOST_CHECK_EQUAL(inD.membersByName("ext").size(), 1);
+
+	// Attaching functions in D must not change the shared list.
+	BOOST_CHECK(withoutScope.membersByName("ext").empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -131,6 +131,65 @@ BOOST_AUTO_TEST_CASE(storage_layout_arrays)
 	BOOST_CHECK(ArrayType(DataLocation::Storage, TypeProvider::fixedBytes(32), 9).storageSize() == 9);
 }
 
+BOOST_AUTO_TEST_CASE(member_lookup_by_name)
+{
+	Type const* uint256 = TypeProvider::uint256();
+	Type const* boolType = TypeProvider::boolean();
+	MemberList members(MemberList::MemberMap({
+		{"f", uint256},
+		{"g", boolType},
+		{"f", boolType}
+	}));
+	BOOST_CHECK_EQUAL(members.memberType("g"), boolType);
+	BOOST_CHECK(members.memberType("h") == nullptr);
+	MemberList::MemberMap overloads = members.membersByName("f");
+	BOOST_REQUIRE_EQUAL(overloads.size(), 2);
+	BOOST_CHECK_EQUAL(overloads[0].type, uint256);
+	BOOST_CHECK_EQUAL(overloads[1].type, boolType);
+	BOOST_CHECK(members.membersByName("h").empty());
+
+	// Members added later have to be found even if the index was already built.
+	members.combine(MemberList(MemberList::MemberMap({{"h", uint256}, {"f", uint256}})));
+	BOOST_CHECK_EQUAL(members.memberType("h"), uint256);
+	BOOST_CHECK_EQUAL(members.membersByName("f").size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(interned_types)
+{
+	ArrayType const* uintArray = TypeProvider::array(DataLocation::Memory, TypeProvider::uint256());
+	BOOST_CHECK_EQUAL(uintArray, TypeProvider::array(DataLocation::Memory, TypeProvider::uint256()));
+	BOOST_CHECK_NE(uintArray, TypeProvider::array(DataLocation::Calldata, TypeProvider::uint256()));
+	BOOST_CHECK_EQUAL(
+		TypeProvider::array(DataLocation::Storage, uintArray, 3),
+		TypeProvider::array(DataLocation::Storage, uintArray, 3)
+	);
+	BOOST_CHECK_NE(
+		TypeProvider::array(DataLocation::Storage, uintArray, 3),
+		TypeProvider::array(DataLocation::Storage, uintArray, 4)
+	);
+	BOOST_CHECK_EQUAL(
+		TypeProvider::tuple({uintArray, TypeProvider::boolean()}),
+		TypeProvider::tuple({uintArray, TypeProvider::boolean()})
+	);
+	BOOST_CHECK_EQUAL(
+		TypeProvider::mapping(TypeProvider::address(), "", uintArray, ""),
+		TypeProvider::mapping(TypeProvider::address(), "", uintArray, "")
+	);
+	// Key and value names are not part of the type's equality but are still retained.
+	BOOST_CHECK_NE(
+		TypeProvider::mapping(TypeProvider::address(), "owner", uintArray, ""),
+		TypeProvider::mapping(TypeProvider::address(), "", uintArray, "")
+	);
+	Type const* storageArray = TypeProvider::withLocation(uintArray, DataLocation::Storage, true);
+	BOOST_CHECK_EQUAL(storageArray, TypeProvider::withLocation(uintArray, DataLocation::Storage, true));
+	BOOST_CHECK(*storageArray == *TypeProvider::array(DataLocation::Storage, TypeProvider::uint256()));
+	BOOST_CHECK_EQUAL(TypeProvider::rationalNumber(rational(1, 2)), TypeProvider::rationalNumber(rational(2, 4)));
+	BOOST_CHECK_NE(
+		TypeProvider::rationalNumber(rational(1)),
+		TypeProvider::rationalNumber(rational(1), TypeProvider::fixedBytes(1))
+	);
+}
+
 BOOST_AUTO_TEST_CASE(type_identifier_escaping)
 {
 	BOOST_CHECK_EQUAL(Type::escapeIdentifier("("), "$_");
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <boost/test/unit_test.hpp>
+#include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
@@ -1257,6 +1258,116 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_stack_shuffling_limit)
+{
+	auto input = [](string const& _limit) {
+		return R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"optimizer": { "details": {
+					"yul": true,
+					"yulDetails": { "stackAllocation": true, "stackShufflingLimit": )" + _limit + R"( }
+				} }
+			},
+			"sources": {
+				"fileA": {
+					"content": "contract A { }"
+				}
+			}
+		}
+		)";
+	};
+	string const expectedError =
+		"settings.optimizer.details.yulDetails.stackShufflingLimit must be an unsigned integer not greater than 16.";
+
+	BOOST_CHECK(containsAtMostWarnings(compile(input("16"))));
+	BOOST_CHECK(containsError(compile(input("17")), "JSONError", expectedError));
+	BOOST_CHECK(containsError(compile(input("-1")), "JSONError", expectedError));
+}
+
+BOOST_AUTO_TEST_CASE(reuse_optimized_ir)
+{
+	string const source =
+		"// SPDX-License-Identifier: GPL-3.0\n"
+		"pragma solidity >=0.0;\n"
+		"contract C { uint public x; constructor(uint _x) { x = _x; } }\n"
+		"contract D { function f() public returns (C) { return new C(42); } }\n";
+	auto input = [&](bool _reuseOptimizedIR, bool _requestIROptimized) {
+		Json::Value input;
+		input["language"] = "Solidity";
+		input["sources"]["fileA"]["content"] = source;
+		input["settings"]["viaIR"] = true;
+		input["settings"]["reuseOptimizedIR"] = _reuseOptimizedIR;
+		input["settings"]["optimizer"]["enabled"] = true;
+		Json::Value& outputs = input["settings"]["outputSelection"]["fileA"]["D"];
+		outputs.append("evm.bytecode.object");
+		if (_requestIROptimized)
+			outputs.append("irOptimized");
+		return util::jsonCompactPrint(input);
+	};
+
+	Json::Value reparsed = compile(input(false, true));
+	BOOST_REQUIRE(containsAtMostWarnings(reparsed));
+	Json::Value const& reparsedContract = getContractResult(reparsed, "fileA", "D");
+	string const bytecode = reparsedContract["evm"]["bytecode"]["object"].asString();
+	BOOST_REQUIRE(!bytecode.empty());
+	BOOST_CHECK(!reparsedContract["irOptimized"].asString().empty());
+
+	for (bool requestIROptimized: {true, false})
+	{
+		Json::Value reused = compile(input(true, requestIROptimized));
+		BOOST_REQUIRE(containsAtMostWarnings(reused));
+		Json::Value const& reusedContract = getContractResult(reused, "fileA", "D");
+		BOOST_CHECK_EQUAL(reusedContract["evm"]["bytecode"]["object"].asString(), bytecode);
+		if (requestIROptimized)
+			BOOST_CHECK_EQUAL(reusedContract["irOptimized"].asString(), reparsedContract["irOptimized"].asString());
+		else
+			BOOST_CHECK(!reusedContract.isMember("irOptimized"));
+	}
+
+	// Without IR output, the optimized IR is not printed at all.
+	auto compileWithStack = [&](bool _reuseOptimizedIR) {
+		auto stack = make_unique<CompilerStack>();
+		stack->setSources({{"fileA", source}});
+		stack->setViaIR(true);
+		stack->setReuseOptimizedIR(_reuseOptimizedIR);
+		stack->setOptimiserSettings(OptimiserSettings::standard());
+		BOOST_REQUIRE(stack->compile());
+		return stack;
+	};
+	auto reusingStack = compileWithStack(true);
+	auto reparsingStack = compileWithStack(false);
+	BOOST_CHECK(reusingStack->yulIROptimized("fileA:D").empty());
+	BOOST_CHECK(!reparsingStack->yulIROptimized("fileA:D").empty());
+	BOOST_CHECK(reusingStack->object("fileA:D").bytecode == reparsingStack->object("fileA:D").bytecode);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_parsing_disabled)
+{
+	// Close to the maximum recursion depth of the parser, which worker threads
+	// with a small default stack size might not reach.
+	size_t const depth = 550;
+	string const nested =
+		"pragma solidity >=0.0;\n"
+		"contract C { function f() public pure { " + string(depth, '{') + string(depth, '}') + " } }\n";
+	auto input = [&](Json::Value const& _concurrentParsing) {
+		Json::Value input;
+		input["language"] = "Solidity";
+		input["sources"]["fileA"]["content"] = nested;
+		input["sources"]["fileB"]["content"] = "pragma solidity >=0.0;\ncontract D {}\n";
+		input["settings"]["concurrentParsing"] = _concurrentParsing;
+		return util::jsonCompactPrint(input);
+	};
+
+	Json::Value result = compile(input(false));
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK(result["sources"].isMember("fileA"));
+	BOOST_CHECK(result["sources"].isMember("fileB"));
+
+	BOOST_CHECK(containsError(compile(input("no")), "JSONError", "\"settings.concurrentParsing\" must be a Boolean."));
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
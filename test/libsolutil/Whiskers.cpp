@@ -241,6 +241,22 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(same_template_multiple_instances)
+{
+	string templ = "<?c><a><!c>(<#l><b></l>)</c>";
+	vector<map<string, string>> list(2);
+	list[0]["b"] = "x";
+	list[1]["b"] = "y";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("a", "A")("l", list).render(), "A");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false)("a", "B")("l", list).render(), "(xy)");
+	Whiskers incomplete(templ);
+	incomplete("c", true);
+	BOOST_CHECK_THROW(incomplete.render(), WhiskersError);
+	BOOST_CHECK_THROW(Whiskers("a <?b"), WhiskersError);
+	// Parsed templates are cached, invalid ones must not be, so the second attempt has to fail as well.
+	BOOST_CHECK_THROW(Whiskers("a <?b"), WhiskersError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -191,6 +191,49 @@ BOOST_AUTO_TEST_CASE(to_string)
 	BOOST_CHECK_EQUAL(asmStack.print(), expectation);
 }
 
+BOOST_AUTO_TEST_CASE(prepared_sub_objects)
+{
+	auto makeStack = [](OptimiserSettings _optimiserSettings) {
+		return YulStack(
+			solidity::test::CommonOptions::get().evmVersion(),
+			solidity::test::CommonOptions::get().eofVersion(),
+			YulStack::Language::StrictAssembly,
+			std::move(_optimiserSettings),
+			DebugInfoSelection::All()
+		);
+	};
+	string subObjectCode = R"(object "i" { code { sstore(0, add(1, 2)) } data "j" "def" })";
+	YulStack subObjectStack = makeStack(OptimiserSettings::full());
+	BOOST_REQUIRE(subObjectStack.parseAndAnalyze("source", subObjectCode));
+	subObjectStack.optimize();
+	shared_ptr<Object> subObject = subObjectStack.parserResult();
+	shared_ptr<Block> subObjectBlock = subObject->code;
+	string subObjectPrinted = subObjectStack.print();
+
+	YulStack stack = makeStack(OptimiserSettings::full());
+	BOOST_REQUIRE(stack.parseAndAnalyze(
+		"source",
+		R"(object "O" {
+			code { sstore(datasize("i"), datasize("D.i.j")) }
+			object "D" { code { sstore(0, dataoffset("i")) } data "k" "abc" }
+		})",
+		{{"O", {subObject}}, {"D", {subObject}}}
+	));
+	stack.optimize();
+
+	// Prepared sub-objects are placed in front of data and are not optimized again.
+	Object const& object = *stack.parserResult();
+	BOOST_REQUIRE_EQUAL(object.subObjects.size(), 2);
+	BOOST_CHECK(object.subObjects[1] == subObject);
+	BOOST_CHECK_EQUAL(object.subIndexByName.at("i"_yulstring), 1);
+	auto const& deployed = dynamic_cast<Object const&>(*object.subObjects[0]);
+	BOOST_REQUIRE_EQUAL(deployed.subObjects.size(), 2);
+	BOOST_CHECK(deployed.subObjects[0] == subObject);
+	BOOST_CHECK_EQUAL(deployed.subIndexByName.at("k"_yulstring), 1);
+	BOOST_CHECK(subObject->code == subObjectBlock);
+	BOOST_CHECK_EQUAL(subObjectStack.print(), subObjectPrinted);
+}
+
 BOOST_AUTO_TEST_CASE(use_src_empty)
 {
 	auto const [mapping, _] = tryGetSourceLocationMapping("");
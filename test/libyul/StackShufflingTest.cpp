@@ -17,9 +17,15 @@
 /**
  * Unit tests for stack shuffling.
  */
+#include <test/Common.h>
+
 #include <libyul/backends/evm/StackHelpers.h>
+#include <libsolutil/CommonData.h>
+
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity::langutil;
 
@@ -49,6 +55,73 @@ BOOST_AUTO_TEST_CASE(swap_cycle)
 	createStackLayout(sourceStack, targetStack, [](auto){}, [](auto){}, [](){});
 }
 
+BOOST_AUTO_TEST_CASE(optimal_shuffle_is_never_worse_than_heuristic)
+{
+	std::vector<Scope::Variable> scopeVariables;
+	std::vector<VariableSlot> v;
+	for (size_t i = 0; i < 4; ++i)
+		scopeVariables.emplace_back(Scope::Variable{""_yulstring, YulString{"v" + to_string(i)}});
+	for (size_t i = 0; i < 4; ++i)
+		v.emplace_back(VariableSlot{scopeVariables[i]});
+
+	EVMVersion const evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Stack sourceStack{v[0], v[1], v[2], v[3]};
+	std::vector<size_t> permutation{0, 1, 2, 3};
+	do
+	{
+		Stack targetStack;
+		for (size_t index: permutation)
+			targetStack.emplace_back(v[index]);
+		for (Stack const& target: {
+			targetStack,
+			targetStack + Stack{v[permutation.front()]},
+			Stack{LiteralSlot{42}} + targetStack,
+			Stack{targetStack.begin() + 1, targetStack.end()},
+			Stack{targetStack.begin(), targetStack.end() - 2} + Stack{JunkSlot{}, v[permutation.back()]}
+		})
+		{
+			auto optimal = findOptimalShuffle(sourceStack, target, 6, evmVersion);
+			BOOST_REQUIRE(optimal);
+			ShuffleCost heuristicCost = heuristicShuffleCost(sourceStack, target, evmVersion);
+			BOOST_CHECK(!(heuristicCost < optimal->cost));
+
+			Stack stack = sourceStack;
+			createStackLayout(stack, target, [](auto){}, [](auto){}, [](){}, OptimalShufflingSettings{5, evmVersion});
+			BOOST_CHECK_EQUAL(stack.size(), target.size());
+		}
+	}
+	while (std::next_permutation(permutation.begin(), permutation.end()));
+}
+
+BOOST_AUTO_TEST_CASE(optimal_shuffle_operations)
+{
+	std::vector<Scope::Variable> scopeVariables;
+	std::vector<VariableSlot> v;
+	for (size_t i = 0; i < 3; ++i)
+		scopeVariables.emplace_back(Scope::Variable{""_yulstring, YulString{"v" + to_string(i)}});
+	for (size_t i = 0; i < 3; ++i)
+		v.emplace_back(VariableSlot{scopeVariables[i]});
+
+	Stack sourceStack{v[0], v[1], v[2]};
+	Stack targetStack{v[2], v[1], v[0], v[0]};
+	auto optimal = findOptimalShuffle(sourceStack, targetStack, 4, EVMVersion{});
+	BOOST_REQUIRE(optimal);
+	// SWAP2 DUP1
+	BOOST_REQUIRE_EQUAL(optimal->operations.size(), 2);
+	BOOST_CHECK(optimal->operations[0].kind == ShuffleOperation::Kind::Swap);
+	BOOST_CHECK_EQUAL(optimal->operations[0].swapDepth, 2);
+	BOOST_CHECK(optimal->operations[1].kind == ShuffleOperation::Kind::PushOrDup);
+	BOOST_CHECK(optimal->operations[1].slot == StackSlot{v[0]});
+	BOOST_CHECK_EQUAL(optimal->cost.gas, 6);
+	BOOST_CHECK_EQUAL(optimal->cost.size, 2);
+
+	Stack stack = sourceStack;
+	std::vector<unsigned> swaps;
+	createStackLayout(stack, targetStack, [&](unsigned _depth) { swaps.emplace_back(_depth); }, [](auto){}, [](){}, OptimalShufflingSettings{4, EVMVersion{}});
+	BOOST_CHECK(stack == targetStack);
+	BOOST_CHECK(swaps == std::vector<unsigned>{2});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -65,6 +65,7 @@
 #include <libyul/backends/wasm/WasmDialect.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/CompilabilityChecker.h>
+#include <libyul/Utilities.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -342,6 +343,7 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 				frontend::OptimiserSettings::DefaultYulOptimiserCleanupSteps,
 				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
 			);
+			m_ast = m_object->code;
 		}},
 		{"stackLimitEvader", [&]() {
 			disambiguate();
@@ -390,6 +392,40 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 			FakeUnreachableGenerator fakeUnreachableGenerator;
 			fakeUnreachableGenerator(*m_ast);
 			StackLimitEvader::run(*m_context, *m_object, fakeUnreachableGenerator.fakeUnreachables);
+		}},
+		{"fakeStackTooDeepLimitEvader", [&]() {
+			disambiguate();
+			// Report a stack too deep error for every call to a function called "stackTooDeep".
+			// The first argument of the call is the deficit, the remaining arguments are the variable choices.
+			struct FakeStackTooDeepGenerator: ASTWalker
+			{
+				map<YulString, vector<StackLayoutGenerator::StackTooDeep>> fakeStackTooDeepErrors;
+				using ASTWalker::operator();
+				void operator()(FunctionDefinition const& _function) override
+				{
+					YulString originalFunctionName = m_currentFunction;
+					m_currentFunction = _function.name;
+					ASTWalker::operator()(_function);
+					m_currentFunction = originalFunctionName;
+				}
+				void operator()(FunctionCall const& _call) override
+				{
+					if (_call.functionName.name == "stackTooDeep"_yulstring)
+					{
+						yulAssert(!_call.arguments.empty(), "");
+						StackLayoutGenerator::StackTooDeep stackTooDeep;
+						stackTooDeep.deficit = static_cast<size_t>(valueOfLiteral(std::get<Literal>(_call.arguments.front())));
+						for (size_t i = 1; i < _call.arguments.size(); ++i)
+							stackTooDeep.variableChoices.emplace_back(std::get<Identifier>(_call.arguments[i]).name);
+						fakeStackTooDeepErrors[m_currentFunction].emplace_back(std::move(stackTooDeep));
+					}
+					ASTWalker::operator()(_call);
+				}
+				YulString m_currentFunction = YulString{};
+			};
+			FakeStackTooDeepGenerator fakeStackTooDeepGenerator;
+			fakeStackTooDeepGenerator(*m_ast);
+			StackLimitEvader::run(*m_context, *m_object, fakeStackTooDeepGenerator.fakeStackTooDeepErrors, true);
 		}}
 	};
 }